@@ -45,6 +45,15 @@
 #endif // ENTT_PAGE_SIZE
 
 
+#ifndef ENTT_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#else // defined(__GNUC__) || defined(__clang__)
+#define ENTT_PREFETCH(addr) ((void)(addr))
+#endif // defined(__GNUC__) || defined(__clang__)
+#endif // ENTT_PREFETCH
+
+
 #ifndef ENTT_DISABLE_ASSERT
 #include <cassert>
 #define ENTT_ASSERT(condition) assert(condition)
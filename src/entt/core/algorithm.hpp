@@ -2,10 +2,20 @@
 #define ENTT_CORE_ALGORITHM_HPP
 
 
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <exception>
+#include <condition_variable>
+#include <type_traits>
 #include <utility>
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include "../config/config.h"
 #include "utility.hpp"
 
 
@@ -90,6 +100,15 @@ struct radix_sort {
      * This implementation is inspired by the online book
      * [Physically Based Rendering](http://www.pbr-book.org/3ed-2018/Primitives_and_Intersection_Acceleration/Bounding_Volume_Hierarchies.html#RadixSort).
      *
+     * The signature of the _getter_ should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * Key(const Type &);
+     * @endcode
+     *
+     * Where `Type` is the value type of the iterators and `Key` an unsigned
+     * integral type.
+     *
      * @tparam It Type of random access iterator.
      * @tparam Getter Type of _getter_ function object.
      * @param first An iterator to the first element of the range to sort.
@@ -97,7 +116,8 @@ struct radix_sort {
      * @param getter A valid _getter_ function object.
      */
     template<typename It, typename Getter = identity>
-    void operator()(It first, It last, Getter getter = Getter{}) const {
+    std::enable_if_t<std::is_invocable_v<Getter, const typename std::iterator_traits<It>::value_type &>>
+    operator()(It first, It last, Getter getter = Getter{}) const {
         if(first < last) {
             static constexpr auto mask = (1 << Bit) - 1;
             static constexpr auto buckets = 1 << Bit;
@@ -137,6 +157,314 @@ struct radix_sort {
 };
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+class worker_pool {
+    void work() {
+        std::unique_lock<std::mutex> lock{mutex};
+
+        // workers take part in all the runs, even those started before they were spawned
+        for(std::size_t seen{};; ++seen) {
+            wake.wait(lock, [this, seen]() { return stop || generation != seen; });
+
+            if(stop) {
+                return;
+            }
+
+            lock.unlock();
+            task(data);
+            lock.lock();
+
+            if(!--pending) {
+                done.notify_one();
+            }
+        }
+    }
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stop = true;
+        }
+
+        wake.notify_all();
+
+        for(auto &&worker: workers) {
+            worker.join();
+        }
+
+        workers.clear();
+        stop = false;
+    }
+
+    void spawn() {
+        try {
+            for(auto extra = count; extra; --extra) {
+                workers.emplace_back(&worker_pool::work, this);
+            }
+        } catch(...) {
+            shutdown();
+            throw;
+        }
+    }
+
+public:
+    worker_pool(const std::size_t size) ENTT_NOEXCEPT
+        : count{size}
+    {}
+
+    ~worker_pool() {
+        shutdown();
+    }
+
+    template<typename Func>
+    void run(Func &func) {
+        // callers that share the workers take turns
+        std::lock_guard<std::mutex> turn{running};
+
+        // workers are spawned on the first run, not all the executors get to one
+        if(workers.empty()) {
+            spawn();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            task = [](void *instance) { (*static_cast<Func *>(instance))(); };
+            data = &func;
+            pending = workers.size();
+            ++generation;
+        }
+
+        wake.notify_all();
+        func();
+
+        std::unique_lock<std::mutex> lock{mutex};
+        done.wait(lock, [this]() { return !pending; });
+    }
+
+private:
+    const std::size_t count;
+    std::vector<std::thread> workers{};
+    std::mutex running{};
+    std::mutex mutex{};
+    std::condition_variable wake{};
+    std::condition_variable done{};
+    void(* task)(void *){};
+    void *data{};
+    std::size_t pending{};
+    std::size_t generation{};
+    bool stop{};
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
+/**
+ * @brief Function object to run a set of independent jobs on the calling
+ * thread.
+ *
+ * Jobs are executed in order, one at a time. This is the default executor of
+ * the functions that accept one.
+ */
+struct sequential_for {
+    /**
+     * @brief Runs a set of jobs on the calling thread.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param count Number of jobs to run.
+     * @param func A valid function object, invoked once for each job.
+     */
+    template<typename Func>
+    void operator()(const std::size_t count, Func func) const {
+        for(std::size_t curr{}; curr < count; ++curr) {
+            func(curr);
+        }
+    }
+};
+
+
+/**
+ * @brief Function object to run a set of independent jobs on multiple threads.
+ *
+ * Jobs are identified by their indexes and are picked up by the workers in
+ * order, one at a time. Each job is executed exactly once, either by the
+ * calling thread or by one of the workers. The function returns only after all
+ * the jobs are completed.<br/>
+ * Workers are spawned the first time more than one job is run and are shared by
+ * all the copies of an executor. Therefore, an executor should be created once
+ * and reused rather than created every time some jobs are to be run.
+ *
+ * If a job throws an exception, the jobs that weren't started yet are skipped
+ * and the exception is rethrown to the caller once the others are completed.
+ *
+ * @warning
+ * Callers that share the same workers take turns. Therefore, jobs must not use
+ * the executor that runs them, otherwise the program is blocked.
+ */
+struct parallel_for {
+    /**
+     * @brief Constructs a function object that uses a given number of threads.
+     * @param concurrency Number of threads to use, calling thread included.
+     */
+    parallel_for(const std::size_t concurrency = std::thread::hardware_concurrency())
+        : workers{concurrency ? concurrency : 1u},
+          pool{workers > 1u ? std::make_shared<internal::worker_pool>(workers - 1u) : nullptr}
+    {}
+
+    /**
+     * @brief Runs a set of jobs on multiple threads.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const std::size_t);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param count Number of jobs to run.
+     * @param func A valid function object, invoked once for each job.
+     */
+    template<typename Func>
+    void operator()(const std::size_t count, Func func) const {
+        std::atomic<std::size_t> next{};
+        std::exception_ptr error{};
+        std::mutex guard{};
+
+        auto job = [&next, &error, &guard, &func, count]() {
+            for(auto curr = next++; curr < count; curr = next++) {
+                try {
+                    func(curr);
+                } catch(...) {
+                    std::lock_guard<std::mutex> lock{guard};
+                    error = error ? error : std::current_exception();
+                    next = count;
+                }
+            }
+        };
+
+        if(pool && count > 1u) {
+            pool->run(job);
+        } else {
+            job();
+        }
+
+        if(error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /*! @brief Number of threads to use, calling thread included. */
+    std::size_t workers;
+
+private:
+    std::shared_ptr<internal::worker_pool> pool;
+};
+
+
+/**
+ * @brief Function object for performing parallel sort.
+ *
+ * The range is split in as many partitions as the threads in use. Partitions
+ * are sorted independently with `std::sort`, then merged in pairs until a
+ * single sorted range is left. Merges at the same level run in parallel.<br/>
+ * Short ranges are sorted on the calling thread and don't spawn any worker.
+ * Sorts that are repeated over time should share a long-lived `parallel_for`
+ * rather than spawning new workers each time.
+ *
+ * @warning
+ * The comparison function object is invoked concurrently from multiple threads.
+ * If it throws an exception, the exception is rethrown to the caller and the
+ * order of the elements in the range is unspecified.
+ */
+struct parallel_sort {
+    /*! @brief Minimum number of elements per thread. */
+    static constexpr std::size_t grain = 4096u;
+
+    /**
+     * @brief Constructs a function object that uses a given number of threads.
+     * @param concurrency Number of threads to use, calling thread included.
+     */
+    parallel_sort(const std::size_t concurrency = std::thread::hardware_concurrency())
+        : exec{concurrency}
+    {}
+
+    /**
+     * @brief Constructs a function object that shares the workers of a given
+     * executor.
+     * @param executor A valid executor.
+     */
+    parallel_sort(parallel_for executor) ENTT_NOEXCEPT
+        : exec{std::move(executor)}
+    {}
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given binary comparison function.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Compare Type of comparison function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     */
+    template<typename It, typename Compare = std::less<>>
+    void operator()(It first, It last, Compare compare = Compare{}) const {
+        const std::size_t length = std::distance(first, last);
+        const auto parts = (std::min)(exec.workers, length / grain);
+
+        if(parts < 2u) {
+            std::sort(std::move(first), std::move(last), std::move(compare));
+        } else {
+            std::vector<It> bounds{};
+
+            for(std::size_t pos{}; pos <= parts; ++pos) {
+                bounds.push_back(first + length * pos / parts);
+            }
+
+            exec(parts, [&bounds, &compare](const std::size_t pos) {
+                std::sort(bounds[pos], bounds[pos + 1u], compare);
+            });
+
+            for(std::size_t step = 1u; step < parts; step *= 2u) {
+                exec((parts + 2u * step - 1u) / (2u * step), [&bounds, &compare, parts, step](const std::size_t pos) {
+                    const auto from = pos * 2u * step;
+                    const auto mid = (std::min)(from + step, parts);
+                    const auto to = (std::min)(from + 2u * step, parts);
+
+                    if(mid < to) {
+                        std::inplace_merge(bounds[from], bounds[mid], bounds[to], compare);
+                    }
+                });
+            }
+        }
+    }
+
+    /*! @brief Executor used to run the jobs. */
+    parallel_for exec;
+};
+
+
 }
 
 
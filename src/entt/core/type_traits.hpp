@@ -169,6 +169,46 @@ template<class Type>
 constexpr auto is_equality_comparable_v = is_equality_comparable<Type>::value;
 
 
+/**
+ * @brief Extracts the class and the type of a data member.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a data member pointer.
+ */
+template<typename>
+struct member_traits;
+
+
+/**
+ * @brief Extracts the class and the type of a data member.
+ * @tparam Class Type of the class to which the data member belongs.
+ * @tparam Type Type of the data member.
+ */
+template<typename Class, typename Type>
+struct member_traits<Type Class:: *> {
+    /*! @brief Type of the class to which the data member belongs. */
+    using class_type = Class;
+    /*! @brief Type of the data member. */
+    using type = Type;
+};
+
+
+/**
+ * @brief Helper type.
+ * @tparam Member A valid data member pointer.
+ */
+template<auto Member>
+using member_class_t = typename member_traits<decltype(Member)>::class_type;
+
+
+/**
+ * @brief Helper type.
+ * @tparam Member A valid data member pointer.
+ */
+template<auto Member>
+using member_type_t = typename member_traits<decltype(Member)>::type;
+
+
 /*! @brief Traits class used mainly to push things across boundaries. */
 template<typename>
 struct named_type_traits;
@@ -20,6 +20,10 @@ class basic_view;
 template<typename>
 class basic_runtime_view;
 
+/*! @class basic_runtime_query */
+template<typename, bool = false>
+class basic_runtime_query;
+
 /*! @class basic_group */
 template<typename...>
 class basic_group;
@@ -28,10 +32,26 @@ class basic_group;
 template<typename>
 class basic_observer;
 
+/*! @class basic_batch_observer */
+template<typename>
+class basic_batch_observer;
+
 /*! @struct basic_actor */
 template <typename>
 struct basic_actor;
 
+/*! @class basic_hash_index */
+template<typename, auto>
+class basic_hash_index;
+
+/*! @class basic_ordered_index */
+template<typename, auto>
+class basic_ordered_index;
+
+/*! @class basic_grid_index */
+template<typename, auto...>
+class basic_grid_index;
+
 /*! @class basic_snapshot */
 template<typename>
 class basic_snapshot;
@@ -56,9 +76,33 @@ using registry = basic_registry<entity>;
 /*! @brief Alias declaration for the most common use case. */
 using observer = basic_observer<entity>;
 
+/*! @brief Alias declaration for the most common use case. */
+using batch_observer = basic_batch_observer<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using actor = basic_actor<entity>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Member Data member of a component to use as a key.
+ */
+template<auto Member>
+using hash_index = basic_hash_index<entity, Member>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Member Data member of a component to use as a key.
+ */
+template<auto Member>
+using ordered_index = basic_ordered_index<entity, Member>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Member Data members of a component to use as coordinates.
+ */
+template<auto... Member>
+using grid_index = basic_grid_index<entity, Member...>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<entity>;
 
@@ -78,6 +122,9 @@ using view = basic_view<entity, Types...>;
 /*! @brief Alias declaration for the most common use case. */
 using runtime_view = basic_runtime_view<entity>;
 
+/*! @brief Alias declaration for the most common use case. */
+using runtime_query = basic_runtime_query<entity>;
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Types Types of components iterated by the group.
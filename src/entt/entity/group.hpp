@@ -3,9 +3,13 @@
 
 
 #include <tuple>
+#include <chrono>
 #include <utility>
+#include <algorithm>
+#include <functional>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
 #include "../core/type_traits.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -81,7 +85,14 @@ class basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>> {
 
     template<typename Func, typename... Weak>
     void traverse(Func func, type_list<Weak...>) const {
-        for(const auto entt: *handler) {
+        traverse(std::move(func), type_list<Weak...>{}, handler->begin(), handler->end());
+    }
+
+    template<typename Func, typename... Weak>
+    void traverse(Func func, type_list<Weak...>, typename sparse_set<Entity>::iterator_type first, typename sparse_set<Entity>::iterator_type last) const {
+        for(; first != last; ++first) {
+            const auto entt = *first;
+
             if constexpr(std::is_invocable_v<Func, decltype(get<Weak>({}))...>) {
                 func(std::get<pool_type<Weak> *>(pools)->get(entt)...);
             } else {
@@ -322,6 +333,126 @@ public:
         traverse(std::move(func), type_list<Get...>{});
     }
 
+    /**
+     * @brief Iterates entities and components for a limited number of entities
+     * and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Get &...);
+     * void(Get &...);
+     * @endcode
+     *
+     * At most `count` entities are visited, starting from the given cursor.
+     *
+     * @sa cursor
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param count Maximum number of entities to visit.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Func>
+    cursor each(const cursor from, const size_type count, Func func) const {
+        using difference_type = typename iterator_type::difference_type;
+        const auto last = (std::min)(from.next, handler->size());
+        const auto length = (std::min)(last, count);
+        const auto first = handler->end() - difference_type(last);
+        traverse(std::move(func), type_list<Get...>{}, first, first + difference_type(length));
+        return cursor{last - length, handler};
+    }
+
+    /**
+     * @brief Iterates entities and components until a deadline is reached and
+     * applies the given function object to them.
+     *
+     * The deadline is checked every `cursor::granularity` entities. Apart from
+     * this, this function works exactly as its counterpart that accepts a
+     * maximum number of entities.
+     *
+     * @sa cursor
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the time point.
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param deadline Point in time after which the iteration is suspended.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Clock, typename Duration, typename Func>
+    cursor each(cursor from, const std::chrono::time_point<Clock, Duration> deadline, Func func) const {
+        while(!from.done() && Clock::now() < deadline) {
+            from = each(from, cursor::granularity, std::ref(func));
+        }
+
+        return from;
+    }
+
+    /**
+     * @brief Combines in parallel the results of a transformation applied to
+     * all the entities and components.
+     *
+     * The transformation is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the transformation must be equivalent to one of the
+     * following forms:
+     *
+     * @code{.cpp}
+     * Ret(const entity_type, Get &...);
+     * Ret(Get &...);
+     * @endcode
+     *
+     * Entities are split in chunks of the given size. Chunks are processed by
+     * the given executor and each of them produces a partial result. The
+     * default executor runs them on the calling thread, a `parallel_for`
+     * spreads them over its workers. Partial results are then combined with
+     * the initial value one after the other, in the same order in which the
+     * chunks are iterated. Therefore, as long as the chunk size doesn't
+     * change, the result doesn't depend on the number of threads used and
+     * it's the same bit for bit from run to run.
+     *
+     * @warning
+     * Both the transformation and the reduction are likely invoked from
+     * multiple threads at the same time and must be safe to use this way.
+     *
+     * @tparam Type Type of the result.
+     * @tparam Reduce Type of the binary reduction function object.
+     * @tparam Transform Type of the transformation function object.
+     * @tparam Exec Type of the executor to use to process the chunks.
+     * @param init Initial value of the reduction.
+     * @param reduce A valid binary reduction function object.
+     * @param transform A valid transformation function object.
+     * @param chunk Number of entities per chunk.
+     * @param exec A valid executor (see `sequential_for` and `parallel_for`
+     * for more details).
+     * @return The result of the reduction.
+     */
+    template<typename Type, typename Reduce, typename Transform, typename Exec = sequential_for>
+    Type transform_reduce(Type init, Reduce reduce, Transform transform, const size_type chunk = 1024u, Exec exec = Exec{}) const {
+        return internal::chunked_reduce(std::move(init), reduce, handler->size(), chunk, exec, [this, &transform](const auto first, const auto last, auto fold) {
+            using difference_type = typename iterator_type::difference_type;
+            const auto begin = handler->begin();
+
+            if constexpr(std::is_invocable_v<Transform, decltype(get<Get>({}))...>) {
+                traverse([&transform, &fold](auto &&... curr) -> void {
+                    fold(transform(std::forward<decltype(curr)>(curr)...));
+                }, type_list<Get...>{}, begin + difference_type(first), begin + difference_type(last));
+            } else {
+                traverse([&transform, &fold](const entity_type entt, auto &&... curr) -> void {
+                    fold(transform(entt, std::forward<decltype(curr)>(curr)...));
+                }, type_list<Get...>{}, begin + difference_type(first), begin + difference_type(last));
+            }
+        });
+    }
+
     /**
      * @brief Iterates entities and components and applies the given function
      * object to them.
@@ -365,6 +496,11 @@ public:
      * bool(const Entity, const Entity);
      * @endcode
      *
+     * When a single component or no component at all is provided, a projection
+     * can be used in place of the comparison function. Its signature should be
+     * equivalent to either `Key(const Component &)` or `Key(const Entity)`.
+     * See `sparse_set::sort` for more details.
+     *
      * Where `Component` are such that they are iterated by the group.<br/>
      * Moreover, the comparison function object shall induce a
      * _strict weak ordering_ on the values.
@@ -392,8 +528,12 @@ public:
     template<typename... Component, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&... args) {
         if constexpr(sizeof...(Component) == 0) {
-            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type>);
+            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type> || std::is_invocable_v<Compare, const entity_type>);
             handler->sort(handler->begin(), handler->end(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(sizeof...(Component) == 1 && std::is_invocable_v<Compare, decltype(get<Component>({}))...>) {
+            handler->sort(handler->begin(), handler->end(), [this, compare = std::move(compare)](const entity_type entt) {
+                return compare((std::get<pool_type<Component> *>(pools)->get(entt), ...));
+            }, std::move(algo), std::forward<Args>(args)...);
         }  else if constexpr(sizeof...(Component) == 1) {
             handler->sort(handler->begin(), handler->end(), [this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
                 return compare((std::get<pool_type<Component> *>(pools)->get(lhs), ...), (std::get<pool_type<Component> *>(pools)->get(rhs), ...));
@@ -499,10 +639,15 @@ class basic_group<Entity, exclude_t<Exclude...>, get_t<Get...>, Owned...> {
 
     template<typename Func, typename... Strong, typename... Weak>
     void traverse(Func func, type_list<Strong...>, type_list<Weak...>) const {
-        [[maybe_unused]] auto it = std::make_tuple((std::get<pool_type<Strong> *>(pools)->end() - *length)...);
-        [[maybe_unused]] auto data = std::get<0>(pools)->sparse_set<entity_type>::end() - *length;
+        traverse(std::move(func), type_list<Strong...>{}, type_list<Weak...>{}, *length, *length);
+    }
+
+    template<typename Func, typename... Strong, typename... Weak>
+    void traverse(Func func, type_list<Strong...>, type_list<Weak...>, const std::size_t last, const std::size_t count) const {
+        [[maybe_unused]] auto it = std::make_tuple((std::get<pool_type<Strong> *>(pools)->end() - last)...);
+        [[maybe_unused]] auto data = std::get<0>(pools)->sparse_set<entity_type>::end() - last;
 
-        for(auto next = *length; next; --next) {
+        for(auto next = count; next; --next) {
             if constexpr(std::is_invocable_v<Func, decltype(get<Strong>({}))..., decltype(get<Weak>({}))...>) {
                 if constexpr(sizeof...(Weak) == 0) {
                     func(*(std::get<component_iterator_type<Strong>>(it)++)...);
@@ -741,6 +886,121 @@ public:
         traverse(std::move(func), type_list<Owned...>{}, type_list<Get...>{});
     }
 
+    /**
+     * @brief Iterates entities and components for a limited number of entities
+     * and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Owned &..., Get &...);
+     * void(Owned &..., Get &...);
+     * @endcode
+     *
+     * At most `count` entities are visited, starting from the given cursor.
+     *
+     * @sa cursor
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param count Maximum number of entities to visit.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Func>
+    cursor each(const cursor from, const size_type count, Func func) const {
+        const auto last = (std::min)(from.next, *length);
+        const auto amount = (std::min)(last, count);
+        traverse(std::move(func), type_list<Owned...>{}, type_list<Get...>{}, last, amount);
+        return cursor{last - amount, super};
+    }
+
+    /**
+     * @brief Iterates entities and components until a deadline is reached and
+     * applies the given function object to them.
+     *
+     * The deadline is checked every `cursor::granularity` entities. Apart from
+     * this, this function works exactly as its counterpart that accepts a
+     * maximum number of entities.
+     *
+     * @sa cursor
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the time point.
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param deadline Point in time after which the iteration is suspended.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Clock, typename Duration, typename Func>
+    cursor each(cursor from, const std::chrono::time_point<Clock, Duration> deadline, Func func) const {
+        while(!from.done() && Clock::now() < deadline) {
+            from = each(from, cursor::granularity, std::ref(func));
+        }
+
+        return from;
+    }
+
+    /**
+     * @brief Combines in parallel the results of a transformation applied to
+     * all the entities and components.
+     *
+     * The transformation is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the transformation must be equivalent to one of the
+     * following forms:
+     *
+     * @code{.cpp}
+     * Ret(const entity_type, Owned &..., Get &...);
+     * Ret(Owned &..., Get &...);
+     * @endcode
+     *
+     * Entities are split in chunks of the given size. Chunks are processed by
+     * the given executor and each of them produces a partial result. The
+     * default executor runs them on the calling thread, a `parallel_for`
+     * spreads them over its workers. Partial results are then combined with
+     * the initial value one after the other, in the same order in which the
+     * chunks are iterated. Therefore, as long as the chunk size doesn't
+     * change, the result doesn't depend on the number of threads used and
+     * it's the same bit for bit from run to run.
+     *
+     * @warning
+     * Both the transformation and the reduction are likely invoked from
+     * multiple threads at the same time and must be safe to use this way.
+     *
+     * @tparam Type Type of the result.
+     * @tparam Reduce Type of the binary reduction function object.
+     * @tparam Transform Type of the transformation function object.
+     * @tparam Exec Type of the executor to use to process the chunks.
+     * @param init Initial value of the reduction.
+     * @param reduce A valid binary reduction function object.
+     * @param transform A valid transformation function object.
+     * @param chunk Number of entities per chunk.
+     * @param exec A valid executor (see `sequential_for` and `parallel_for`
+     * for more details).
+     * @return The result of the reduction.
+     */
+    template<typename Type, typename Reduce, typename Transform, typename Exec = sequential_for>
+    Type transform_reduce(Type init, Reduce reduce, Transform transform, const size_type chunk = 1024u, Exec exec = Exec{}) const {
+        return internal::chunked_reduce(std::move(init), reduce, *length, chunk, exec, [this, &transform](const auto first, const auto last, auto fold) {
+            if constexpr(std::is_invocable_v<Transform, decltype(get<Owned>({}))..., decltype(get<Get>({}))...>) {
+                traverse([&transform, &fold](auto &&... curr) -> void {
+                    fold(transform(std::forward<decltype(curr)>(curr)...));
+                }, type_list<Owned...>{}, type_list<Get...>{}, *length - first, last - first);
+            } else {
+                traverse([&transform, &fold](const entity_type entt, auto &&... curr) -> void {
+                    fold(transform(entt, std::forward<decltype(curr)>(curr)...));
+                }, type_list<Owned...>{}, type_list<Get...>{}, *length - first, last - first);
+            }
+        });
+    }
+
     /**
      * @brief Iterates entities and components and applies the given function
      * object to them.
@@ -794,6 +1054,11 @@ public:
      * bool(const Entity, const Entity);
      * @endcode
      *
+     * When a single component or no component at all is provided, a projection
+     * can be used in place of the comparison function. Its signature should be
+     * equivalent to either `Key(const Component &)` or `Key(const Entity)`.
+     * See `sparse_set::sort` for more details.
+     *
      * Where `Component` are either owned types or not but still such that they
      * are iterated by the group.<br/>
      * Moreover, the comparison function object shall induce a
@@ -825,8 +1090,12 @@ public:
         auto *cpool = std::get<0>(pools);
 
         if constexpr(sizeof...(Component) == 0) {
-            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type>);
+            static_assert(std::is_invocable_v<Compare, const entity_type, const entity_type> || std::is_invocable_v<Compare, const entity_type>);
             cpool->sort(cpool->end()-*length, cpool->end(), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(sizeof...(Component) == 1 && std::is_invocable_v<Compare, decltype(get<Component>({}))...>) {
+            cpool->sort(cpool->end()-*length, cpool->end(), [this, compare = std::move(compare)](const entity_type entt) {
+                return compare((std::get<pool_type<Component> *>(pools)->get(entt), ...));
+            }, std::move(algo), std::forward<Args>(args)...);
         } else if constexpr(sizeof...(Component) == 1) {
             cpool->sort(cpool->end()-*length, cpool->end(), [this, compare = std::move(compare)](const entity_type lhs, const entity_type rhs) {
                 return compare((std::get<pool_type<Component> *>(pools)->get(lhs), ...), (std::get<pool_type<Component> *>(pools)->get(rhs), ...));
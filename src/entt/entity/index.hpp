@@ -0,0 +1,1220 @@
+#ifndef ENTT_ENTITY_INDEX_HPP
+#define ENTT_ENTITY_INDEX_HPP
+
+
+#include <tuple>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "registry.hpp"
+#include "storage.hpp"
+#include "utility.hpp"
+#include "entity.hpp"
+#include "view.hpp"
+#include "fwd.hpp"
+
+
+namespace entt {
+
+
+/**
+ * @brief Hash index on a data member of a component.
+ *
+ * A hash index maps the values of a data member of a given component to the
+ * entities that own them. It's kept up to date through the signals of the
+ * registry to which it's connected and it offers constant time lookups.<br/>
+ * Internally, it's an open addressing hash table with linear probing and
+ * backward shift deletion. Multiple entities can share the same key.
+ *
+ * @note
+ * Keys are copied into the index when components are assigned or replaced.
+ * Changing a key in place without notifying the registry (as an example, by
+ * modifying a component returned by `get`) leaves the index out of sync.
+ *
+ * @warning
+ * Lifetime of an index doesn't necessarily have to overcome the one of the
+ * registry to which it is connected. However, the index must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Member Data member of a component to use as a key.
+ */
+template<typename Entity, auto Member>
+class basic_hash_index {
+    using component_type = member_class_t<Member>;
+    using key_type = std::remove_cv_t<member_type_t<Member>>;
+
+    static_assert(std::is_default_constructible_v<key_type> && std::is_copy_assignable_v<key_type>);
+
+    struct slot_type {
+        std::size_t hash;
+        key_type key;
+        Entity entt;
+    };
+
+    static std::size_t hash_of(const key_type &key) {
+        // fibonacci hashing spreads poorly distributed hashes (identity for integers) over the table
+        constexpr std::size_t multiplier = (sizeof(std::size_t) == sizeof(std::uint64_t)) ? std::size_t(11400714819323198485ull) : std::size_t(2654435769u);
+        return std::hash<key_type>{}(key) * multiplier;
+    }
+
+    std::size_t home(const std::size_t hash) const ENTT_NOEXCEPT {
+        return hash >> shift;
+    }
+
+    void rehash(const std::size_t capacity) {
+        std::vector<slot_type> other(capacity, slot_type{0u, key_type{}, null});
+        shift = std::numeric_limits<std::size_t>::digits;
+
+        for(auto sz = capacity; sz > 1u; sz >>= 1) {
+            --shift;
+        }
+
+        slots.swap(other);
+        mask = capacity - 1u;
+
+        for(auto &&curr: other) {
+            if(curr.entt != null) {
+                auto pos = home(curr.hash);
+
+                for(; slots[pos].entt != null; pos = (pos + 1u) & mask);
+
+                slots[pos] = std::move(curr);
+            }
+        }
+    }
+
+    void insert(const Entity entt, const key_type &key) {
+        // keeps the load factor below one half, probe sequences remain short
+        if(2u * (keys.size() + 1u) > slots.size()) {
+            rehash(slots.empty() ? 16u : 2u * slots.size());
+        }
+
+        const auto hash = hash_of(key);
+        auto pos = home(hash);
+
+        for(; slots[pos].entt != null; pos = (pos + 1u) & mask);
+
+        slots[pos] = slot_type{hash, key, entt};
+        keys.construct(entt, key);
+    }
+
+    void erase(const Entity entt) {
+        const auto hash = hash_of(keys.get(entt));
+        auto pos = home(hash);
+
+        for(; slots[pos].entt != entt; pos = (pos + 1u) & mask) {
+            ENTT_ASSERT(slots[pos].entt != null);
+        }
+
+        for(auto next = (pos + 1u) & mask; slots[next].entt != null; next = (next + 1u) & mask) {
+            // moves back an element only if its home bucket isn't in (pos, next]
+            if(((next - home(slots[next].hash)) & mask) >= ((next - pos) & mask)) {
+                slots[pos] = std::move(slots[next]);
+                pos = next;
+            }
+        }
+
+        slots[pos].entt = null;
+        keys.destroy(entt);
+    }
+
+    void on_construct(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        insert(entt, instance.*Member);
+    }
+
+    void on_replace(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        if(!(keys.get(entt) == instance.*Member)) {
+            erase(entt);
+            insert(entt, instance.*Member);
+        }
+    }
+
+    void on_destroy(const Entity entt, basic_registry<Entity> &) {
+        erase(entt);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_hash_index() = default;
+
+    /**
+     * @brief Creates an index and connects it to a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    basic_hash_index(basic_registry<entity_type> &reg)
+        : basic_hash_index{}
+    {
+        connect(reg);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_hash_index(const basic_hash_index &) = delete;
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_hash_index(basic_hash_index &&) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_hash_index & operator=(const basic_hash_index &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_hash_index & operator=(basic_hash_index &&) = delete;
+
+    /**
+     * @brief Connects an index to a given registry.
+     *
+     * The index is filled with the entities that already own the component in
+     * the given registry, then it's kept up to date through its signals.
+     *
+     * @param reg A valid reference to a registry.
+     */
+    void connect(basic_registry<entity_type> &reg) {
+        clear();
+
+        reg.template view<const component_type>().each([this](const auto entt, const auto &instance) {
+            insert(entt, instance.*Member);
+        });
+
+        reg.template on_construct<component_type>().template connect<&basic_hash_index::on_construct>(*this);
+        reg.template on_replace<component_type>().template connect<&basic_hash_index::on_replace>(*this);
+        reg.template on_destroy<component_type>().template connect<&basic_hash_index::on_destroy>(*this);
+    }
+
+    /**
+     * @brief Disconnects an index from a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    void disconnect(basic_registry<entity_type> &reg) {
+        reg.template on_construct<component_type>().disconnect(*this);
+        reg.template on_replace<component_type>().disconnect(*this);
+        reg.template on_destroy<component_type>().disconnect(*this);
+    }
+
+    /**
+     * @brief Returns the number of entities in an index.
+     * @return Number of entities.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return keys.size();
+    }
+
+    /**
+     * @brief Checks whether an index is empty.
+     * @return True if the index is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return keys.empty();
+    }
+
+    /**
+     * @brief Returns the number of slots of the underlying table.
+     * @return Capacity of the index.
+     */
+    size_type capacity() const ENTT_NOEXCEPT {
+        return slots.size();
+    }
+
+    /*! @brief Clears an index. */
+    void clear() {
+        slots.clear();
+        keys.reset();
+        mask = {};
+        shift = {};
+    }
+
+    /**
+     * @brief Finds an entity that owns a given key.
+     *
+     * In case multiple entities share the same key, one of them is returned.
+     * Use `each` to visit all of them.
+     *
+     * @param key A valid key.
+     * @return A valid entity if the key exists, the null entity otherwise.
+     */
+    entity_type find(const key_type &key) const {
+        if(!keys.empty()) {
+            const auto hash = hash_of(key);
+
+            for(auto pos = home(hash); slots[pos].entt != null; pos = (pos + 1u) & mask) {
+                if(slots[pos].hash == hash && slots[pos].key == key) {
+                    return slots[pos].entt;
+                }
+            }
+        }
+
+        return null;
+    }
+
+    /**
+     * @brief Checks if an index contains a given key.
+     * @param key A valid key.
+     * @return True if at least an entity owns the given key, false otherwise.
+     */
+    bool contains(const key_type &key) const {
+        return !(find(key) == null);
+    }
+
+    /**
+     * @brief Returns the key owned by an entity according to an index.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the index results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * index doesn't contain the given entity.
+     *
+     * @param entt A valid entity identifier.
+     * @return The key owned by the entity.
+     */
+    const key_type & key(const entity_type entt) const {
+        return keys.get(entt);
+    }
+
+    /**
+     * @brief Iterates all the entities that own a given key.
+     *
+     * The function object is invoked for each entity.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param key A valid key.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const key_type &key, Func func) const {
+        if(!keys.empty()) {
+            const auto hash = hash_of(key);
+
+            for(auto pos = home(hash); slots[pos].entt != null; pos = (pos + 1u) & mask) {
+                if(slots[pos].hash == hash && slots[pos].key == key) {
+                    func(slots[pos].entt);
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<slot_type> slots{};
+    storage<entity_type, key_type> keys{};
+    std::size_t mask{};
+    std::size_t shift{};
+};
+
+/**
+ * @brief Ordered index on a data member of a component.
+ *
+ * An ordered index keeps the entities that own a given component sorted by the
+ * value of one of its data members. It's kept up to date through the signals
+ * of the registry to which it's connected and it offers logarithmic lookups as
+ * well as range queries.<br/>
+ * Internally, it's a flat sequence of sorted blocks of fixed maximum size `B`,
+ * searched by means of a binary search on the last key of each block first and
+ * within a block then. Full blocks are split in half, while blocks that are
+ * less than half full are merged with a neighbour or borrow some entries from
+ * it. Therefore, all blocks but the only one in an index with few entities are
+ * at least half full. Lookups take `O(log N)` time, insertions and removals
+ * take `O(log N + B + N / B)` time, since blocks are shifted when one of them
+ * is split or dropped. Multiple entities can share the same key.
+ *
+ * Keys are compared with `operator<`. Entities that share the same key are
+ * sorted by identifier, so that iterations are fully deterministic.
+ *
+ * @note
+ * Keys are copied into the index when components are assigned or replaced.
+ * Changing a key in place without notifying the registry (as an example, by
+ * modifying a component returned by `get`) leaves the index out of sync.
+ *
+ * @warning
+ * Lifetime of an index doesn't necessarily have to overcome the one of the
+ * registry to which it is connected. However, the index must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Member Data member of a component to use as a key.
+ */
+template<typename Entity, auto Member>
+class basic_ordered_index {
+    using component_type = member_class_t<Member>;
+    using key_type = std::remove_cv_t<member_type_t<Member>>;
+    using view_type = basic_view<Entity, exclude_t<>, component_type>;
+
+    static constexpr std::size_t block_size = 128u;
+
+    struct entry_type {
+        key_type key;
+        Entity entt;
+    };
+
+    using block_type = std::vector<entry_type>;
+
+    static bool less(const entry_type &lhs, const entry_type &rhs) {
+        return lhs.key < rhs.key || (!(rhs.key < lhs.key) && to_integer(lhs.entt) < to_integer(rhs.entt));
+    }
+
+    class iterator {
+        friend class basic_ordered_index<Entity, Member>;
+
+        using blocks_type = const std::vector<block_type>;
+
+        iterator(blocks_type *ref, const std::size_t blk, const std::size_t idx) ENTT_NOEXCEPT
+            : blocks{ref}, block{blk}, pos{idx}
+        {}
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = Entity;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator() ENTT_NOEXCEPT = default;
+
+        iterator & operator++() ENTT_NOEXCEPT {
+            if(++pos == (*blocks)[block].size()) {
+                ++block;
+                pos = {};
+            }
+
+            return *this;
+        }
+
+        iterator operator++(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        bool operator==(const iterator &other) const ENTT_NOEXCEPT {
+            return other.block == block && other.pos == pos;
+        }
+
+        bool operator!=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        pointer operator->() const {
+            return &(*blocks)[block][pos].entt;
+        }
+
+        reference operator*() const {
+            return *operator->();
+        }
+
+        const key_type & key() const {
+            return (*blocks)[block][pos].key;
+        }
+
+    private:
+        blocks_type *blocks;
+        std::size_t block;
+        std::size_t pos;
+    };
+
+    template<typename Compare>
+    iterator bound(const key_type &key, Compare compare) const {
+        const auto blk = std::partition_point(blocks.cbegin(), blocks.cend(), [&key, &compare](const auto &curr) {
+            return compare(curr.back().key, key);
+        });
+
+        if(blk == blocks.cend()) {
+            return end();
+        }
+
+        const auto it = std::partition_point(blk->cbegin(), blk->cend(), [&key, &compare](const auto &curr) {
+            return compare(curr.key, key);
+        });
+
+        return iterator{&blocks, std::size_t(blk - blocks.cbegin()), std::size_t(it - blk->cbegin())};
+    }
+
+    auto locate(const entry_type &elem) {
+        auto blk = std::partition_point(blocks.begin(), blocks.end(), [&elem](const auto &curr) {
+            return less(curr.back(), elem);
+        });
+
+        return std::make_pair(blk, blk == blocks.end() ? typename block_type::iterator{} : std::lower_bound(blk->begin(), blk->end(), elem, &less));
+    }
+
+    void insert(const Entity entt, const key_type &key) {
+        entry_type elem{key, entt};
+        keys.construct(entt, key);
+
+        if(blocks.empty()) {
+            auto &blk = blocks.emplace_back();
+            blk.reserve(block_size);
+            blk.push_back(std::move(elem));
+            return;
+        }
+
+        auto [blk, it] = locate(elem);
+
+        if(blk == blocks.end()) {
+            // past the last element, appended to the last block
+            blk = std::prev(blocks.end());
+            it = blk->end();
+        }
+
+        if(blk->size() == block_size) {
+            // splits full blocks in half to keep insertions cheap
+            const auto half = difference_type(block_size / 2u);
+            const auto offset = it - blk->begin();
+            block_type other{};
+            other.reserve(block_size);
+            other.insert(other.end(), std::make_move_iterator(blk->begin() + half), std::make_move_iterator(blk->end()));
+            blk->erase(blk->begin() + half, blk->end());
+            blk = blocks.insert(std::next(blk), std::move(other));
+
+            if(offset < half) {
+                --blk;
+                it = blk->begin() + offset;
+            } else {
+                it = blk->begin() + (offset - half);
+            }
+        }
+
+        blk->insert(it, std::move(elem));
+    }
+
+    void erase(const Entity entt) {
+        auto [blk, it] = locate(entry_type{keys.get(entt), entt});
+        ENTT_ASSERT(blk != blocks.end() && it != blk->end() && it->entt == entt);
+
+        blk->erase(it);
+        keys.destroy(entt);
+
+        if(blk->size() < block_size / 2u) {
+            if(blocks.size() == 1u) {
+                if(blk->empty()) {
+                    blocks.clear();
+                }
+            } else {
+                // underfull blocks are merged with a neighbour or borrow entries from it
+                const auto lhs = (blk == blocks.begin()) ? blk : std::prev(blk);
+                const auto rhs = std::next(lhs);
+                const auto half = difference_type((lhs->size() + rhs->size()) / 2u);
+
+                if(lhs->size() + rhs->size() <= block_size) {
+                    lhs->insert(lhs->end(), std::make_move_iterator(rhs->begin()), std::make_move_iterator(rhs->end()));
+                    blocks.erase(rhs);
+                } else if(difference_type(lhs->size()) < half) {
+                    const auto from = rhs->begin() + (half - difference_type(lhs->size()));
+                    lhs->insert(lhs->end(), std::make_move_iterator(rhs->begin()), std::make_move_iterator(from));
+                    rhs->erase(rhs->begin(), from);
+                } else {
+                    const auto from = lhs->begin() + half;
+                    rhs->insert(rhs->begin(), std::make_move_iterator(from), std::make_move_iterator(lhs->end()));
+                    lhs->erase(from, lhs->end());
+                }
+            }
+        }
+    }
+
+    void on_construct(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        insert(entt, instance.*Member);
+    }
+
+    void on_replace(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        if(const auto &curr = keys.get(entt); curr < instance.*Member || instance.*Member < curr) {
+            erase(entt);
+            insert(entt, instance.*Member);
+        }
+    }
+
+    void on_destroy(const Entity entt, basic_registry<Entity> &) {
+        erase(entt);
+    }
+
+    using difference_type = typename block_type::difference_type;
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type. */
+    using iterator_type = iterator;
+
+    /*! @brief Default constructor. */
+    basic_ordered_index() = default;
+
+    /**
+     * @brief Creates an index and connects it to a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    basic_ordered_index(basic_registry<entity_type> &reg)
+        : basic_ordered_index{}
+    {
+        connect(reg);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_ordered_index(const basic_ordered_index &) = delete;
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_ordered_index(basic_ordered_index &&) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_ordered_index & operator=(const basic_ordered_index &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_ordered_index & operator=(basic_ordered_index &&) = delete;
+
+    /**
+     * @brief Connects an index to a given registry.
+     *
+     * The index is filled with the entities that already own the component in
+     * the given registry, then it's kept up to date through its signals.
+     *
+     * @param reg A valid reference to a registry.
+     */
+    void connect(basic_registry<entity_type> &reg) {
+        clear();
+        view.emplace(reg.template view<component_type>());
+
+        std::vector<entry_type> sorted{};
+        sorted.reserve(view->size());
+
+        view->each([&sorted](const auto entt, const auto &instance) {
+            sorted.push_back(entry_type{instance.*Member, entt});
+        });
+
+        // bulk loads existing components, blocks are filled up to one half
+        std::sort(sorted.begin(), sorted.end(), &less);
+
+        for(auto first = sorted.begin(), last = sorted.end(); first != last;) {
+            const auto next = first + (std::min)(last - first, difference_type(block_size / 2u));
+            auto &blk = blocks.emplace_back();
+            blk.reserve(block_size);
+
+            for(; first != next; ++first) {
+                keys.construct(first->entt, first->key);
+                blk.push_back(std::move(*first));
+            }
+        }
+
+        reg.template on_construct<component_type>().template connect<&basic_ordered_index::on_construct>(*this);
+        reg.template on_replace<component_type>().template connect<&basic_ordered_index::on_replace>(*this);
+        reg.template on_destroy<component_type>().template connect<&basic_ordered_index::on_destroy>(*this);
+    }
+
+    /**
+     * @brief Disconnects an index from a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    void disconnect(basic_registry<entity_type> &reg) {
+        reg.template on_construct<component_type>().disconnect(*this);
+        reg.template on_replace<component_type>().disconnect(*this);
+        reg.template on_destroy<component_type>().disconnect(*this);
+    }
+
+    /**
+     * @brief Returns the number of entities in an index.
+     * @return Number of entities.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return keys.size();
+    }
+
+    /**
+     * @brief Checks whether an index is empty.
+     * @return True if the index is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return keys.empty();
+    }
+
+    /*! @brief Clears an index. */
+    void clear() {
+        blocks.clear();
+        keys.reset();
+    }
+
+    /**
+     * @brief Returns an iterator to the entity with the lowest key.
+     *
+     * The returned iterator points to the first entity of the index. If the
+     * index is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the index.
+     */
+    iterator_type begin() const ENTT_NOEXCEPT {
+        return iterator{&blocks, 0u, 0u};
+    }
+
+    /**
+     * @brief Returns an iterator that is past the entity with the highest key.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the index. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @return An iterator to the entity following the last entity of the
+     * index.
+     */
+    iterator_type end() const ENTT_NOEXCEPT {
+        return iterator{&blocks, blocks.size(), 0u};
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity whose key isn't less than
+     * the given value.
+     * @param key A valid key.
+     * @return An iterator to the first entity whose key isn't less than the
+     * given value, `end()` if there is no such an entity.
+     */
+    iterator_type lower_bound(const key_type &key) const {
+        return bound(key, [](const auto &lhs, const auto &rhs) { return lhs < rhs; });
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity whose key is greater than
+     * the given value.
+     * @param key A valid key.
+     * @return An iterator to the first entity whose key is greater than the
+     * given value, `end()` if there is no such an entity.
+     */
+    iterator_type upper_bound(const key_type &key) const {
+        return bound(key, [](const auto &lhs, const auto &rhs) { return !(rhs < lhs); });
+    }
+
+    /**
+     * @brief Returns the key owned by an entity according to an index.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the index results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * index doesn't contain the given entity.
+     *
+     * @param entt A valid entity identifier.
+     * @return The key owned by the entity.
+     */
+    const key_type & key(const entity_type entt) const {
+        return keys.get(entt);
+    }
+
+    /**
+     * @brief Iterates a range of entities in key order and applies the given
+     * function object to them and their components.
+     *
+     * The function object is invoked for each entity in the range. It is
+     * provided with the entity itself and a reference to its component.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, component_type &);
+     * void(component_type &);
+     * @endcode
+     *
+     * @note
+     * Replacing, removing or assigning the indexed component during the
+     * iteration invalidates the iterators of the index.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param first An iterator to the first entity of the range to visit.
+     * @param last An iterator past the last entity of the range to visit.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(iterator_type first, iterator_type last, Func func) const {
+        for(; first != last; ++first) {
+            if constexpr(std::is_invocable_v<Func, decltype(view->get({}))>) {
+                func(view->get(*first));
+            } else {
+                func(*first, view->get(*first));
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates all entities in key order and applies the given function
+     * object to them and their components.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        each(begin(), end(), std::move(func));
+    }
+
+private:
+    std::vector<block_type> blocks{};
+    storage<entity_type, key_type> keys{};
+    std::optional<view_type> view{};
+};
+
+
+/**
+ * @brief Spatial index on the coordinates of a component.
+ *
+ * A grid index partitions the space in a uniform grid of square (or cubic)
+ * cells and keeps track of the entities that fall in each cell. It's kept up to
+ * date through the signals of the registry to which it's connected and it
+ * offers box and radius queries that only visit the cells they overlap.<br/>
+ * Coordinates are copied in the buckets of the cells along with the entities,
+ * so that queries don't have to touch the components to test them. Removals
+ * take constant time, since every entity knows its position within its cell.
+ *
+ * @note
+ * Coordinates are copied into the index when components are assigned or
+ * replaced. Changing them in place without notifying the registry (as an
+ * example, by modifying a component returned by `get`) leaves the index out of
+ * sync.
+ *
+ * @warning
+ * Lifetime of an index doesn't necessarily have to overcome the one of the
+ * registry to which it is connected. However, the index must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Member Data members of a component to use as coordinates.
+ */
+template<typename Entity, auto... Member>
+class basic_grid_index {
+    static_assert(sizeof...(Member) == 2u || sizeof...(Member) == 3u);
+
+    using component_type = std::common_type_t<member_class_t<Member>...>;
+    using coord_type = std::common_type_t<member_type_t<Member>...>;
+    using real_type = std::common_type_t<coord_type, float>;
+    using point_type = std::array<coord_type, sizeof...(Member)>;
+    using cell_type = std::array<std::int32_t, sizeof...(Member)>;
+
+    static_assert((std::is_same_v<member_class_t<Member>, component_type> && ...));
+    static_assert((std::is_same_v<std::remove_cv_t<member_type_t<Member>>, coord_type> && ...));
+    static_assert(std::is_arithmetic_v<coord_type>);
+
+    struct cell_hash {
+        std::size_t operator()(const cell_type &cell) const ENTT_NOEXCEPT {
+            constexpr std::size_t prime[3u]{73856093u, 19349663u, 83492791u};
+            std::size_t hash{};
+
+            for(std::size_t pos{}; pos < cell.size(); ++pos) {
+                hash ^= std::size_t(std::uint32_t(cell[pos])) * prime[pos];
+            }
+
+            return hash;
+        }
+    };
+
+    struct entry_type {
+        Entity entt;
+        point_type point;
+    };
+
+    struct location_type {
+        cell_type cell;
+        std::size_t pos;
+    };
+
+    using bucket_type = std::vector<entry_type>;
+
+    template<typename Point>
+    cell_type cell_of(const Point &point) const {
+        constexpr auto lowest = (std::numeric_limits<std::int32_t>::min)();
+        constexpr auto highest = (std::numeric_limits<std::int32_t>::max)();
+        cell_type cell{};
+
+        for(std::size_t pos{}; pos < cell.size(); ++pos) {
+            const auto value = std::floor(real_type(point[pos]) / side);
+            ENTT_ASSERT(!std::isnan(value));
+            // coordinates that are out of the range of the grid fall in the outermost cells
+            cell[pos] = value < real_type(lowest) ? lowest : (value < real_type(highest) ? static_cast<std::int32_t>(value) : highest);
+        }
+
+        return cell;
+    }
+
+    static point_type point_of(const component_type &instance) {
+        return point_type{instance.*Member...};
+    }
+
+    void insert(const Entity entt, const point_type &point) {
+        const auto cell = cell_of(point);
+
+        if(cells.empty()) {
+            bounds = { cell, cell };
+        } else {
+            for(std::size_t pos{}; pos < cell.size(); ++pos) {
+                bounds[0u][pos] = (std::min)(bounds[0u][pos], cell[pos]);
+                bounds[1u][pos] = (std::max)(bounds[1u][pos], cell[pos]);
+            }
+        }
+
+        auto &bucket = cells[cell];
+        locations.construct(entt, location_type{cell, bucket.size()});
+        bucket.push_back(entry_type{entt, point});
+    }
+
+    void erase(const Entity entt) {
+        const auto &location = locations.get(entt);
+        const auto it = cells.find(location.cell);
+        ENTT_ASSERT(it != cells.end() && it->second[location.pos].entt == entt);
+        auto &bucket = it->second;
+
+        if(location.pos != bucket.size() - 1u) {
+            bucket[location.pos] = std::move(bucket.back());
+            locations.get(bucket[location.pos].entt).pos = location.pos;
+        }
+
+        if(bucket.pop_back(); bucket.empty()) {
+            cells.erase(it);
+        }
+
+        locations.destroy(entt);
+    }
+
+    void on_construct(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        insert(entt, point_of(instance));
+    }
+
+    void on_replace(const Entity entt, basic_registry<Entity> &, const component_type &instance) {
+        const auto point = point_of(instance);
+
+        if(const auto &location = locations.get(entt); location.cell == cell_of(point)) {
+            // moves within the same cell don't require any bookkeeping
+            cells[location.cell][location.pos].point = point;
+        } else {
+            erase(entt);
+            insert(entt, point);
+        }
+    }
+
+    void on_destroy(const Entity entt, basic_registry<Entity> &) {
+        erase(entt);
+    }
+
+    template<typename Test, typename Func>
+    static void test_all(const bucket_type &bucket, Test &test, Func &func) {
+        for(auto &&elem: bucket) {
+            if(test(elem.point)) {
+                func(elem.entt);
+            }
+        }
+    }
+
+    template<std::size_t Dim, typename Test, typename Func>
+    void visit(const cell_type &first, const cell_type &last, cell_type &curr, Test &test, Func &func) const {
+        // the last cell can be the outermost one, incrementing past it would overflow
+        for(curr[Dim] = first[Dim]; ; ++curr[Dim]) {
+            if constexpr(Dim == 0u) {
+                if(const auto it = cells.find(curr); it != cells.cend()) {
+                    test_all(it->second, test, func);
+                }
+            } else {
+                visit<Dim - 1u>(first, last, curr, test, func);
+            }
+
+            if(curr[Dim] == last[Dim]) {
+                break;
+            }
+        }
+    }
+
+    template<typename Point, typename Test, typename Func>
+    void query(const Point &min, const Point &max, Test test, Func func) const {
+        if(!locations.empty()) {
+            auto first = cell_of(min);
+            auto last = cell_of(max);
+            std::size_t volume{1u};
+
+            // cells outside of the occupied ones are never visited
+            for(std::size_t pos{}; pos < first.size(); ++pos) {
+                first[pos] = (std::max)(first[pos], bounds[0u][pos]);
+                last[pos] = (std::min)(last[pos], bounds[1u][pos]);
+
+                if(last[pos] < first[pos]) {
+                    return;
+                }
+
+                const auto length = std::size_t(std::int64_t{last[pos]} - first[pos]) + 1u;
+                volume = (volume > cells.size() / length) ? cells.size() + 1u : volume * length;
+            }
+
+            if(cells.size() < volume) {
+                // sparse grids are cheaper to scan than to probe cell by cell
+                for(auto &&[cell, bucket]: cells) {
+                    bool within = true;
+
+                    for(std::size_t pos{}; pos < cell.size() && within; ++pos) {
+                        within = !(cell[pos] < first[pos] || last[pos] < cell[pos]);
+                    }
+
+                    if(within) {
+                        test_all(bucket, test, func);
+                    }
+                }
+            } else {
+                cell_type curr{};
+                visit<sizeof...(Member) - 1u>(first, last, curr, test, func);
+            }
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Creates an index and connects it to a given registry.
+     * @param reg A valid reference to a registry.
+     * @param cell Length of the side of the cells of the grid.
+     */
+    basic_grid_index(basic_registry<entity_type> &reg, const real_type cell)
+        : side{cell}
+    {
+        ENTT_ASSERT(cell > real_type{});
+        connect(reg);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_grid_index(const basic_grid_index &) = delete;
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_grid_index(basic_grid_index &&) = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_grid_index & operator=(const basic_grid_index &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This index.
+     */
+    basic_grid_index & operator=(basic_grid_index &&) = delete;
+
+    /**
+     * @brief Connects an index to a given registry.
+     *
+     * The index is filled with the entities that already own the component in
+     * the given registry, then it's kept up to date through its signals.
+     *
+     * @param reg A valid reference to a registry.
+     */
+    void connect(basic_registry<entity_type> &reg) {
+        clear();
+
+        reg.template view<const component_type>().each([this](const auto entt, const auto &instance) {
+            insert(entt, point_of(instance));
+        });
+
+        reg.template on_construct<component_type>().template connect<&basic_grid_index::on_construct>(*this);
+        reg.template on_replace<component_type>().template connect<&basic_grid_index::on_replace>(*this);
+        reg.template on_destroy<component_type>().template connect<&basic_grid_index::on_destroy>(*this);
+    }
+
+    /**
+     * @brief Disconnects an index from a given registry.
+     * @param reg A valid reference to a registry.
+     */
+    void disconnect(basic_registry<entity_type> &reg) {
+        reg.template on_construct<component_type>().disconnect(*this);
+        reg.template on_replace<component_type>().disconnect(*this);
+        reg.template on_destroy<component_type>().disconnect(*this);
+    }
+
+    /**
+     * @brief Returns the number of entities in an index.
+     * @return Number of entities.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return locations.size();
+    }
+
+    /**
+     * @brief Checks whether an index is empty.
+     * @return True if the index is empty, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return locations.empty();
+    }
+
+    /**
+     * @brief Returns the length of the side of the cells of the grid.
+     * @return Length of the side of the cells.
+     */
+    real_type cell() const ENTT_NOEXCEPT {
+        return side;
+    }
+
+    /*! @brief Clears an index. */
+    void clear() {
+        cells.clear();
+        locations.reset();
+    }
+
+    /**
+     * @brief Iterates the entities within an axis-aligned box.
+     *
+     * The function object is invoked for each entity whose coordinates are
+     * within the given bounds, bounds included.<br/>
+     * Entities are returned cell by cell. The signature of the function must
+     * be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param min Lower bounds of the box, one per coordinate.
+     * @param max Upper bounds of the box, one per coordinate.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const point_type &min, const point_type &max, Func func) const {
+        query(min, max, [&min, &max](const point_type &point) {
+            for(std::size_t pos{}; pos < point.size(); ++pos) {
+                if(point[pos] < min[pos] || max[pos] < point[pos]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }, std::move(func));
+    }
+
+    /**
+     * @brief Iterates the entities within a sphere (or a circle).
+     *
+     * The function object is invoked for each entity whose distance from the
+     * given center doesn't exceed the radius.<br/>
+     * Entities are returned cell by cell. The signature of the function must
+     * be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param center Center of the sphere, one value per coordinate.
+     * @param radius Radius of the sphere.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const point_type &center, const real_type radius, Func func) const {
+        std::array<real_type, sizeof...(Member)> min{}, max{};
+
+        for(std::size_t pos{}; pos < center.size(); ++pos) {
+            min[pos] = real_type(center[pos]) - radius;
+            max[pos] = real_type(center[pos]) + radius;
+        }
+
+        query(min, max, [&center, sqr = radius * radius](const point_type &point) {
+            real_type distance{};
+
+            for(std::size_t pos{}; pos < point.size(); ++pos) {
+                const auto diff = real_type(point[pos]) - real_type(center[pos]);
+                distance += diff * diff;
+            }
+
+            return !(sqr < distance);
+        }, std::move(func));
+    }
+
+    /**
+     * @brief Iterates the entities within an axis-aligned box that are also
+     * part of a given filter.
+     *
+     * A filter is any object that offers a `contains` member function that
+     * accepts an entity, such as views, groups and runtime views. This way, a
+     * spatial query is intersected with other component filters on the fly,
+     * without ever materializing the set of candidates.
+     *
+     * @sa each
+     *
+     * @tparam Filter Type of filter to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param min Lower bounds of the box, one per coordinate.
+     * @param max Upper bounds of the box, one per coordinate.
+     * @param filter A valid filter.
+     * @param func A valid function object.
+     */
+    template<typename Filter, typename Func>
+    void each(const point_type &min, const point_type &max, const Filter &filter, Func func) const {
+        each(min, max, [&filter, &func](const auto entt) {
+            if(filter.contains(entt)) {
+                func(entt);
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates the entities within a sphere (or a circle) that are also
+     * part of a given filter.
+     *
+     * A filter is any object that offers a `contains` member function that
+     * accepts an entity, such as views, groups and runtime views. This way, a
+     * spatial query is intersected with other component filters on the fly,
+     * without ever materializing the set of candidates.
+     *
+     * @sa each
+     *
+     * @tparam Filter Type of filter to use.
+     * @tparam Func Type of the function object to invoke.
+     * @param center Center of the sphere, one value per coordinate.
+     * @param radius Radius of the sphere.
+     * @param filter A valid filter.
+     * @param func A valid function object.
+     */
+    template<typename Filter, typename Func>
+    void each(const point_type &center, const real_type radius, const Filter &filter, Func func) const {
+        each(center, radius, [&filter, &func](const auto entt) {
+            if(filter.contains(entt)) {
+                func(entt);
+            }
+        });
+    }
+
+private:
+    real_type side;
+    std::unordered_map<cell_type, bucket_type, cell_hash> cells{};
+    storage<entity_type, location_type> locations{};
+    // bounds of the occupied cells, they don't shrink until the grid is empty
+    std::array<cell_type, 2u> bounds{};
+};
+
+
+
+}
+
+
+#endif // ENTT_ENTITY_INDEX_HPP
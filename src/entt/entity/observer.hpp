@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <utility>
 #include <algorithm>
+#include <vector>
+#include <functional>
 #include <type_traits>
 #include "../config/config.h"
 #include "../core/type_traits.hpp"
@@ -52,7 +54,7 @@ struct basic_collector<> {
      */
     template<typename... AllOf, typename... NoneOf>
     static constexpr auto group(exclude_t<NoneOf...> = {}) ENTT_NOEXCEPT {
-        return basic_collector<matcher<type_list<>, type_list<>, type_list<NoneOf...>, AllOf...>>{};
+        return basic_collector<matcher<type_list<>, type_list<>, type_list<>, type_list<NoneOf...>, AllOf...>>{};
     }
 
     /**
@@ -62,7 +64,7 @@ struct basic_collector<> {
      */
     template<typename AnyOf>
     static constexpr auto replace() ENTT_NOEXCEPT {
-        return basic_collector<matcher<type_list<>, type_list<>, AnyOf>>{};
+        return basic_collector<matcher<type_list<>, type_list<>, type_list<>, AnyOf>>{};
     }
 };
 
@@ -71,13 +73,14 @@ struct basic_collector<> {
  * @copydetails basic_collector<>
  * @tparam Reject Untracked types used to filter out entities.
  * @tparam Require Untracked types required by the matcher.
+ * @tparam Filter Predicates required to be satisfied by the matcher.
  * @tparam Rule Specific details of the current matcher.
  * @tparam Other Other matchers.
  */
-template<typename... Reject, typename... Require, typename... Rule, typename... Other>
-struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, Rule...>, Other...> {
+template<typename... Reject, typename... Require, typename... Filter, typename... Rule, typename... Other>
+struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, type_list<Filter...>, Rule...>, Other...> {
     /*! @brief Current matcher. */
-    using current_type = matcher<type_list<Reject...>, type_list<Require...>, Rule...>;
+    using current_type = matcher<type_list<Reject...>, type_list<Require...>, type_list<Filter...>, Rule...>;
 
     /**
      * @brief Adds a grouping matcher to the collector.
@@ -87,7 +90,7 @@ struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, Rule
      */
     template<typename... AllOf, typename... NoneOf>
     static constexpr auto group(exclude_t<NoneOf...> = {}) ENTT_NOEXCEPT {
-        return basic_collector<matcher<type_list<>, type_list<>, type_list<NoneOf...>, AllOf...>, current_type, Other...>{};
+        return basic_collector<matcher<type_list<>, type_list<>, type_list<>, type_list<NoneOf...>, AllOf...>, current_type, Other...>{};
     }
 
     /**
@@ -97,7 +100,7 @@ struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, Rule
      */
     template<typename AnyOf>
     static constexpr auto replace() ENTT_NOEXCEPT {
-        return basic_collector<matcher<type_list<>, type_list<>, AnyOf>, current_type, Other...>{};
+        return basic_collector<matcher<type_list<>, type_list<>, type_list<>, AnyOf>, current_type, Other...>{};
     }
 
     /**
@@ -108,7 +111,33 @@ struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, Rule
      */
     template<typename... AllOf, typename... NoneOf>
     static constexpr auto where(exclude_t<NoneOf...> = {}) ENTT_NOEXCEPT {
-        using extended_type = matcher<type_list<Reject..., NoneOf...>, type_list<Require..., AllOf...>, Rule...>;
+        using extended_type = matcher<type_list<Reject..., NoneOf...>, type_list<Require..., AllOf...>, type_list<Filter...>, Rule...>;
+        return basic_collector<extended_type, Other...>{};
+    }
+
+    /**
+     * @brief Adds a predicate to the filter of the last added matcher.
+     *
+     * The predicate is invoked whenever the matcher finds that an entity
+     * matches its requirements and the entity is registered only if it returns
+     * true. The signature of the predicate must be equivalent to the following
+     * form:
+     *
+     * @code{.cpp}
+     * bool(const registry &, const entity);
+     * @endcode
+     *
+     * Where `registry` and `entity` are the types of the registry and the
+     * entities to observe. Predicates of observing matchers can also accept a
+     * const reference to the new instance of the component as a third
+     * argument.
+     *
+     * @tparam Candidate Function to use as a predicate.
+     * @return The updated collector.
+     */
+    template<auto Candidate>
+    static constexpr auto when() ENTT_NOEXCEPT {
+        using extended_type = matcher<type_list<Reject...>, type_list<Require...>, type_list<Filter..., std::integral_constant<decltype(Candidate), Candidate>>, Rule...>;
         return basic_collector<extended_type, Other...>{};
     }
 };
@@ -118,6 +147,110 @@ struct basic_collector<matcher<type_list<Reject...>, type_list<Require...>, Rule
 constexpr basic_collector<> collector{};
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename, typename>
+struct observer_matcher;
+
+
+template<typename Observer, typename... Reject, typename... Require, typename... Filter, typename AnyOf>
+struct observer_matcher<Observer, matcher<type_list<Reject...>, type_list<Require...>, type_list<Filter...>, AnyOf>> {
+    using entity_type = typename Observer::entity_type;
+
+    template<typename Func>
+    static bool accept(const basic_registry<entity_type> &reg, const entity_type entt, const AnyOf &instance) {
+        if constexpr(std::is_invocable_v<decltype(Func::value), const basic_registry<entity_type> &, const entity_type, const AnyOf &>) {
+            return std::invoke(Func::value, reg, entt, instance);
+        } else {
+            return std::invoke(Func::value, reg, entt);
+        }
+    }
+
+    template<std::size_t Index>
+    static void maybe_valid_if(Observer &obs, const entity_type entt, const basic_registry<entity_type> &reg, const AnyOf &instance) {
+        if(reg.template has<Require...>(entt) && !(reg.template has<Reject>(entt) || ...) && (accept<Filter>(reg, entt, instance) && ...)) {
+            obs.template mark<Index>(entt);
+        }
+    }
+
+    template<std::size_t Index>
+    static void discard_if(Observer &obs, const entity_type entt) {
+        obs.template unmark<Index>(entt);
+    }
+
+    template<std::size_t Index>
+    static void connect(Observer &obs, basic_registry<entity_type> &reg) {
+        (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
+        (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
+        reg.template on_replace<AnyOf>().template connect<&maybe_valid_if<Index>>(obs);
+        reg.template on_destroy<AnyOf>().template connect<&discard_if<Index>>(obs);
+    }
+
+    static void disconnect(Observer &obs, basic_registry<entity_type> &reg) {
+        (reg.template on_destroy<Require>().disconnect(obs), ...);
+        (reg.template on_construct<Reject>().disconnect(obs), ...);
+        reg.template on_replace<AnyOf>().disconnect(obs);
+        reg.template on_destroy<AnyOf>().disconnect(obs);
+    }
+};
+
+
+template<typename Observer, typename... Reject, typename... Require, typename... Filter, typename... NoneOf, typename... AllOf>
+struct observer_matcher<Observer, matcher<type_list<Reject...>, type_list<Require...>, type_list<Filter...>, type_list<NoneOf...>, AllOf...>> {
+    using entity_type = typename Observer::entity_type;
+
+    template<std::size_t Index>
+    static void maybe_valid_if(Observer &obs, const entity_type entt, const basic_registry<entity_type> &reg) {
+        if(reg.template has<AllOf...>(entt) && !(reg.template has<NoneOf>(entt) || ...)
+                && reg.template has<Require...>(entt) && !(reg.template has<Reject>(entt) || ...)
+                && (std::invoke(Filter::value, reg, entt) && ...))
+        {
+            obs.template mark<Index>(entt);
+        }
+    }
+
+    template<std::size_t Index>
+    static void discard_if(Observer &obs, const entity_type entt) {
+        obs.template unmark<Index>(entt);
+    }
+
+    template<std::size_t Index>
+    static void connect(Observer &obs, basic_registry<entity_type> &reg) {
+        (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
+        (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
+        (reg.template on_construct<AllOf>().template connect<&maybe_valid_if<Index>>(obs), ...);
+        (reg.template on_destroy<NoneOf>().template connect<&maybe_valid_if<Index>>(obs), ...);
+        (reg.template on_destroy<AllOf>().template connect<&discard_if<Index>>(obs), ...);
+        (reg.template on_construct<NoneOf>().template connect<&discard_if<Index>>(obs), ...);
+    }
+
+    static void disconnect(Observer &obs, basic_registry<entity_type> &reg) {
+        (reg.template on_destroy<Require>().disconnect(obs), ...);
+        (reg.template on_construct<Reject>().disconnect(obs), ...);
+        (reg.template on_construct<AllOf>().disconnect(obs), ...);
+        (reg.template on_destroy<NoneOf>().disconnect(obs), ...);
+        (reg.template on_destroy<AllOf>().disconnect(obs), ...);
+        (reg.template on_construct<NoneOf>().disconnect(obs), ...);
+    }
+};
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
 /**
  * @brief Observer.
  *
@@ -146,6 +279,10 @@ constexpr basic_collector<> collector{};
  * Moreover, a registered entity isn't returned by the observer if the condition
  * set by the filter is broken in the meantime.
  *
+ * Finally, a _when_ clause attaches user defined predicates to a matcher. They
+ * are evaluated along with the filter, before to register the entity. However,
+ * they aren't verified again once the entity is registered.
+ *
  * @b Important
  *
  * Iterators aren't invalidated if:
@@ -171,90 +308,31 @@ template<typename Entity>
 class basic_observer {
     using payload_type = std::uint32_t;
 
-    template<typename>
-    struct matcher_handler;
-
-    template<typename... Reject, typename... Require, typename AnyOf>
-    struct matcher_handler<matcher<type_list<Reject...>, type_list<Require...>, AnyOf>> {
-        template<std::size_t Index>
-        static void maybe_valid_if(basic_observer &obs, const Entity entt, const basic_registry<Entity> &reg) {
-            if(reg.template has<Require...>(entt) && !(reg.template has<Reject>(entt) || ...)) {
-                auto *comp = obs.view.try_get(entt);
-                (comp ? *comp : obs.view.construct(entt)) |= (1 << Index);
-            }
-        }
-
-        template<std::size_t Index>
-        static void discard_if(basic_observer &obs, const Entity entt) {
-            if(auto *value = obs.view.try_get(entt); value && !(*value &= (~(1 << Index)))) {
-                obs.view.destroy(entt);
-            }
-        }
+    template<typename, typename>
+    friend struct internal::observer_matcher;
 
-        template<std::size_t Index>
-        static void connect(basic_observer &obs, basic_registry<Entity> &reg) {
-            (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
-            reg.template on_replace<AnyOf>().template connect<&maybe_valid_if<Index>>(obs);
-            reg.template on_destroy<AnyOf>().template connect<&discard_if<Index>>(obs);
-        }
-
-        static void disconnect(basic_observer &obs, basic_registry<Entity> &reg) {
-            (reg.template on_destroy<Require>().disconnect(obs), ...);
-            (reg.template on_construct<Reject>().disconnect(obs), ...);
-            reg.template on_replace<AnyOf>().disconnect(obs);
-            reg.template on_destroy<AnyOf>().disconnect(obs);
-        }
-    };
-
-    template<typename... Reject, typename... Require, typename... NoneOf, typename... AllOf>
-    struct matcher_handler<matcher<type_list<Reject...>, type_list<Require...>, type_list<NoneOf...>, AllOf...>> {
-        template<std::size_t Index>
-        static void maybe_valid_if(basic_observer &obs, const Entity entt, const basic_registry<Entity> &reg) {
-            if(reg.template has<AllOf...>(entt) && !(reg.template has<NoneOf>(entt) || ...)
-                    && reg.template has<Require...>(entt) && !(reg.template has<Reject>(entt) || ...))
-            {
-                auto *comp = obs.view.try_get(entt);
-                (comp ? *comp : obs.view.construct(entt)) |= (1 << Index);
-            }
-        }
-
-        template<std::size_t Index>
-        static void discard_if(basic_observer &obs, const Entity entt) {
-            if(auto *value = obs.view.try_get(entt); value && !(*value &= (~(1 << Index)))) {
-                obs.view.destroy(entt);
-            }
-        }
-
-        template<std::size_t Index>
-        static void connect(basic_observer &obs, basic_registry<Entity> &reg) {
-            (reg.template on_destroy<Require>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<Reject>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<AllOf>().template connect<&maybe_valid_if<Index>>(obs), ...);
-            (reg.template on_destroy<NoneOf>().template connect<&maybe_valid_if<Index>>(obs), ...);
-            (reg.template on_destroy<AllOf>().template connect<&discard_if<Index>>(obs), ...);
-            (reg.template on_construct<NoneOf>().template connect<&discard_if<Index>>(obs), ...);
-        }
+    template<std::size_t Index>
+    void mark(const Entity entt) {
+        auto *comp = view.try_get(entt);
+        (comp ? *comp : view.construct(entt)) |= (1 << Index);
+    }
 
-        static void disconnect(basic_observer &obs, basic_registry<Entity> &reg) {
-            (reg.template on_destroy<Require>().disconnect(obs), ...);
-            (reg.template on_construct<Reject>().disconnect(obs), ...);
-            (reg.template on_construct<AllOf>().disconnect(obs), ...);
-            (reg.template on_destroy<NoneOf>().disconnect(obs), ...);
-            (reg.template on_destroy<AllOf>().disconnect(obs), ...);
-            (reg.template on_construct<NoneOf>().disconnect(obs), ...);
+    template<std::size_t Index>
+    void unmark(const Entity entt) {
+        if(auto *value = view.try_get(entt); value && !(*value &= (~(1 << Index)))) {
+            view.destroy(entt);
         }
-    };
+    }
 
     template<typename... Matcher>
     static void disconnect(basic_observer &obs, basic_registry<Entity> &reg) {
-        (matcher_handler<Matcher>::disconnect(obs, reg), ...);
+        (internal::observer_matcher<basic_observer, Matcher>::disconnect(obs, reg), ...);
     }
 
     template<typename... Matcher, std::size_t... Index>
     void connect(basic_registry<Entity> &reg, std::index_sequence<Index...>) {
         static_assert(sizeof...(Matcher) < std::numeric_limits<payload_type>::digits);
-        (matcher_handler<Matcher>::template connect<Index>(*this, reg), ...);
+        (internal::observer_matcher<basic_observer, Matcher>::template connect<Index>(*this, reg), ...);
         release = &basic_observer::disconnect<Matcher...>;
     }
 
@@ -436,6 +514,446 @@ private:
 };
 
 
+/**
+ * @brief Batch observer.
+ *
+ * A batch observer returns the same entities of an observer with the same
+ * matchers. However, it's optimized for heavy traffic of signals.<br/>
+ * Matches are recorded as bits of a per-entity mask, thus there is no limit to
+ * the number of matchers and a signal never constructs or destroys elements of
+ * a pool. Entities are appended to a tightly packed list the first time they
+ * match and entities that no longer match are dropped from the list only when
+ * the observer is collected.<br/>
+ * Non-const member functions collect the observer on demand. Const member
+ * functions never modify it instead and it's safe to invoke them from multiple
+ * threads at the same time. However, they require the observer to be collected
+ * after the last signal received (see `collect`).
+ *
+ * The list of entities can be consumed in chunks. Chunks are disjoint,
+ * therefore they can be processed in parallel as long as the observer isn't
+ * modified in the meantime.
+ *
+ * @b Important
+ *
+ * Signals received by the observer invalidate all the iterators and the
+ * pointers returned by the batch observer.
+ *
+ * @warning
+ * Lifetime of an observer doesn't necessarily have to overcome the one of the
+ * registry to which it is connected. However, the observer must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @sa basic_observer
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ */
+template<typename Entity>
+class basic_batch_observer {
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+    using word_type = std::uint64_t;
+
+    static constexpr auto word_size = std::size_t{std::numeric_limits<word_type>::digits};
+
+    template<typename, typename>
+    friend struct internal::observer_matcher;
+
+    static auto position(const Entity entt) ENTT_NOEXCEPT {
+        return std::size_t(to_integer(entt) & traits_type::entity_mask);
+    }
+
+    bool unused(const std::size_t pos) const {
+        const auto first = masks.cbegin() + pos * stride;
+        return std::none_of(first, first + stride, [](const auto word) { return word; });
+    }
+
+    template<std::size_t Index>
+    void mark(const Entity entt) {
+        const auto pos = position(entt);
+
+        if(!(pos < slot.size())) {
+            slot.resize(pos + 1u);
+            masks.resize(slot.size() * stride);
+        }
+
+        if(slot[pos]) {
+            packed[slot[pos] - 1u] = entt;
+        } else {
+            packed.push_back(entt);
+            slot[pos] = packed.size();
+        }
+
+        masks[pos * stride + Index / word_size] |= word_type{1} << (Index % word_size);
+    }
+
+    template<std::size_t Index>
+    void unmark(const Entity entt) {
+        if(const auto pos = position(entt); pos < slot.size() && slot[pos] && packed[slot[pos] - 1u] == entt) {
+            masks[pos * stride + Index / word_size] &= ~(word_type{1} << (Index % word_size));
+            dirty = dirty || unused(pos);
+        }
+    }
+
+    template<typename... Matcher>
+    static void disconnect(basic_batch_observer &obs, basic_registry<Entity> &reg) {
+        (internal::observer_matcher<basic_batch_observer, Matcher>::disconnect(obs, reg), ...);
+    }
+
+    template<typename... Matcher, std::size_t... Index>
+    void connect(basic_registry<Entity> &reg, std::index_sequence<Index...>) {
+        stride = (sizeof...(Matcher) + word_size - 1u) / word_size;
+        (internal::observer_matcher<basic_batch_observer, Matcher>::template connect<Index>(*this, reg), ...);
+        release = &basic_batch_observer::disconnect<Matcher...>;
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type. */
+    using iterator_type = typename std::vector<entity_type>::const_iterator;
+
+    /*! @brief Default constructor. */
+    basic_batch_observer()
+        : target{}, release{}, stride{}
+    {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_batch_observer(const basic_batch_observer &) = delete;
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_batch_observer(basic_batch_observer &&) = delete;
+
+    /**
+     * @brief Creates an observer and connects it to a given registry.
+     * @tparam Matcher Types of matchers to use to initialize the observer.
+     * @param reg A valid reference to a registry.
+     */
+    template<typename... Matcher>
+    basic_batch_observer(basic_registry<entity_type> &reg, basic_collector<Matcher...>)
+        : target{&reg},
+          release{},
+          stride{}
+    {
+        connect<Matcher...>(reg, std::index_sequence_for<Matcher...>{});
+    }
+
+    /*! @brief Default destructor. */
+    ~basic_batch_observer() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This observer.
+     */
+    basic_batch_observer & operator=(const basic_batch_observer &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This observer.
+     */
+    basic_batch_observer & operator=(basic_batch_observer &&) = delete;
+
+    /**
+     * @brief Connects an observer to a given registry.
+     * @tparam Matcher Types of matchers to use to initialize the observer.
+     * @param reg A valid reference to a registry.
+     */
+    template<typename... Matcher>
+    void connect(basic_registry<entity_type> &reg, basic_collector<Matcher...>) {
+        disconnect();
+        clear();
+        slot.clear();
+        masks.clear();
+        connect<Matcher...>(reg, std::index_sequence_for<Matcher...>{});
+        target = &reg;
+    }
+
+    /*! @brief Disconnects an observer from the registry it keeps track of. */
+    void disconnect() {
+        if(release) {
+            release(*this, *target);
+            release = nullptr;
+        }
+    }
+
+    /**
+     * @brief Drops the entities that no longer match from the list.
+     *
+     * Non-const member functions invoke this function on demand. It must be
+     * invoked explicitly only before using the observer through its const
+     * member functions, as an example from multiple threads.
+     */
+    void collect() {
+        if(dirty) {
+            auto last = packed.begin();
+
+            for(const auto entt: packed) {
+                if(const auto pos = position(entt); unused(pos)) {
+                    slot[pos] = {};
+                } else {
+                    *(last++) = entt;
+                    slot[pos] = size_type(last - packed.begin());
+                }
+            }
+
+            packed.erase(last, packed.end());
+            dirty = false;
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements in an observer.
+     *
+     * @warning
+     * Attempting to use an observer that wasn't collected after the last
+     * signal received results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the observer wasn't collected.
+     *
+     * @return Number of elements.
+     */
+    size_type size() const {
+        ENTT_ASSERT(!dirty);
+        return packed.size();
+    }
+
+    /**
+     * @brief Collects an observer and returns the number of its elements.
+     * @return Number of elements.
+     */
+    size_type size() {
+        collect();
+        return packed.size();
+    }
+
+    /**
+     * @brief Checks whether an observer is empty.
+     *
+     * @warning
+     * Attempting to use an observer that wasn't collected after the last
+     * signal received results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the observer wasn't collected.
+     *
+     * @return True if the observer is empty, false otherwise.
+     */
+    bool empty() const {
+        ENTT_ASSERT(!dirty);
+        return packed.empty();
+    }
+
+    /**
+     * @brief Collects an observer and checks whether it's empty.
+     * @return True if the observer is empty, false otherwise.
+     */
+    bool empty() {
+        collect();
+        return packed.empty();
+    }
+
+    /**
+     * @brief Direct access to the list of entities of the observer.
+     *
+     * The returned pointer is such that range `[data(), data() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @warning
+     * Attempting to use an observer that wasn't collected after the last
+     * signal received results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the observer wasn't collected.
+     *
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() const {
+        ENTT_ASSERT(!dirty);
+        return packed.data();
+    }
+
+    /**
+     * @brief Collects an observer and returns its list of entities.
+     * @return A pointer to the array of entities.
+     */
+    const entity_type * data() {
+        collect();
+        return packed.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the observer.
+     *
+     * The returned iterator points to the first entity of the observer. If the
+     * container is empty, the returned iterator will be equal to `end()`.
+     *
+     * @warning
+     * Attempting to use an observer that wasn't collected after the last
+     * signal received results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the observer wasn't collected.
+     *
+     * @return An iterator to the first entity of the observer.
+     */
+    iterator_type begin() const {
+        ENTT_ASSERT(!dirty);
+        return packed.cbegin();
+    }
+
+    /**
+     * @brief Collects an observer and returns an iterator to its first entity.
+     * @return An iterator to the first entity of the observer.
+     */
+    iterator_type begin() {
+        collect();
+        return packed.cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the observer.
+     *
+     * The returned iterator points to the entity following the last entity of
+     * the observer. Attempting to dereference the returned iterator results in
+     * undefined behavior.
+     *
+     * @warning
+     * Attempting to use an observer that wasn't collected after the last
+     * signal received results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the observer wasn't collected.
+     *
+     * @return An iterator to the entity following the last entity of the
+     * observer.
+     */
+    iterator_type end() const {
+        ENTT_ASSERT(!dirty);
+        return packed.cend();
+    }
+
+    /**
+     * @brief Collects an observer and returns an iterator that is past its
+     * last entity.
+     * @return An iterator to the entity following the last entity of the
+     * observer.
+     */
+    iterator_type end() {
+        collect();
+        return packed.cend();
+    }
+
+    /*! @brief Resets the underlying container. */
+    void clear() {
+        if(packed.size() < slot.size() / 2u) {
+            for(const auto entt: packed) {
+                const auto pos = position(entt);
+                std::fill_n(masks.begin() + pos * stride, stride, word_type{});
+                slot[pos] = {};
+            }
+        } else {
+            // cheaper than visiting entities one at a time when most of them match
+            std::fill(masks.begin(), masks.end(), word_type{});
+            std::fill(slot.begin(), slot.end(), size_type{});
+        }
+
+        packed.clear();
+        dirty = false;
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them,
+     * then clears the observer.
+     *
+     * The function object is invoked for each entity.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        static_assert(std::is_invocable_v<Func, entity_type>);
+        std::for_each(begin(), end(), std::move(func));
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them,
+     * then clears the observer.
+     *
+     * The function object is invoked for each entity.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        collect();
+        std::as_const(*this).each(std::move(func));
+        clear();
+    }
+
+    /**
+     * @brief Iterates entities in chunks and applies the given function object
+     * to them.
+     *
+     * The function object is invoked for each chunk of at most `chunk`
+     * entities. Chunks are disjoint, therefore they can be handed over to
+     * different threads.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, const size_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @param chunk Maximum number of entities in a chunk.
+     */
+    template<typename Func>
+    void each_chunk(Func func, const size_type chunk = 1024u) const {
+        static_assert(std::is_invocable_v<Func, const entity_type *, size_type>);
+        ENTT_ASSERT(chunk);
+        const auto *first = data();
+        const auto last = size();
+
+        for(size_type pos{}; pos < last; pos += chunk) {
+            func(first + pos, (std::min)(chunk, last - pos));
+        }
+    }
+
+    /**
+     * @brief Collects an observer, then iterates entities in chunks and
+     * applies the given function object to them.
+     *
+     * @sa each_chunk
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     * @param chunk Maximum number of entities in a chunk.
+     */
+    template<typename Func>
+    void each_chunk(Func func, const size_type chunk = 1024u) {
+        collect();
+        std::as_const(*this).each_chunk(std::move(func), chunk);
+    }
+
+private:
+    basic_registry<entity_type> *target;
+    void(* release)(basic_batch_observer &, basic_registry<entity_type> &);
+    size_type stride;
+    std::vector<word_type> masks{};
+    std::vector<size_type> slot{};
+    std::vector<entity_type> packed{};
+    bool dirty{};
+};
+
+
 }
 
 
@@ -48,6 +48,7 @@ class basic_registry {
 
     using context_family = family<struct internal_registry_context_family>;
     using component_family = family<struct internal_registry_component_family>;
+    using index_family = family<struct internal_registry_index_family>;
     using traits_type = entt_traits<std::underlying_type_t<Entity>>;
 
     template<typename Component>
@@ -75,7 +76,7 @@ class basic_registry {
 
         template<typename... Args>
         decltype(auto) assign(basic_registry &owner, const Entity entt, Args &&... args) {
-            using component_type = std::conditional_t<ENTT_ENABLE_ETO(Component), Component, Component &>;
+            using component_type = std::conditional_t<ENTT_ENABLE_ETO(Component), Component, reference_type>;
             component_type component = storage<Entity, Component>::construct(entt, std::forward<Args>(args)...);
             construction.publish(entt, owner, component);
             return component;
@@ -104,11 +105,36 @@ class basic_registry {
         decltype(auto) replace(basic_registry &owner, const Entity entt, Args &&... args) {
             Component component{std::forward<Args>(args)...};
             update.publish(entt, owner, component);
-            return (storage<Entity, Component>::get(entt) = std::move(component));
+
+            if constexpr(is_shared) {
+                return storage<Entity, Component>::replace(entt, std::move(component));
+            } else {
+                return (storage<Entity, Component>::get(entt) = std::move(component));
+            }
+        }
+
+        template<typename... Func>
+        decltype(auto) patch(basic_registry &owner, const Entity entt, [[maybe_unused]] Func &&... func) {
+            if constexpr(ENTT_ENABLE_ETO(Component)) {
+                update.publish(entt, owner, Component{});
+                return Component{};
+            } else if constexpr(is_shared) {
+                Component component = storage<Entity, Component>::get(entt);
+                (std::forward<Func>(func)(component), ...);
+                update.publish(entt, owner, component);
+                return storage<Entity, Component>::replace(entt, std::move(component));
+            } else {
+                Component &component = storage<Entity, Component>::get(entt);
+                (std::forward<Func>(func)(component), ...);
+                update.publish(entt, owner, component);
+                return component;
+            }
         }
 
     private:
-        using reference_type = std::conditional_t<ENTT_ENABLE_ETO(Component), const Component &, Component &>;
+        // storages that return const references share their objects and can only replace them
+        using reference_type = std::conditional_t<ENTT_ENABLE_ETO(Component), const Component &, decltype(*std::declval<storage<Entity, Component> &>().begin())>;
+        static constexpr bool is_shared = !ENTT_ENABLE_ETO(Component) && std::is_const_v<std::remove_reference_t<reference_type>>;
         sigh<void(const Entity, basic_registry &, reference_type)> construction{};
         sigh<void(const Entity, basic_registry &, reference_type)> update{};
         sigh<void(const Entity, basic_registry &)> destruction{};
@@ -162,6 +188,10 @@ class basic_registry {
         void(* remove)(sparse_set<Entity> &, basic_registry &, const Entity);
         void(* assure)(basic_registry &, const sparse_set<Entity> &);
         const void *(* get)(const sparse_set<Entity> &, const Entity);
+        void *(* mutable_get)(sparse_set<Entity> &, const Entity);
+        const void *(* raw)(const sparse_set<Entity> &);
+        void *(* mutable_raw)(sparse_set<Entity> &);
+        std::size_t stride;
         void(* set)(basic_registry &, const Entity, const void *);
         ENTT_ID_TYPE runtime_type;
     };
@@ -174,6 +204,11 @@ class basic_registry {
         bool(* exclude)(const component) ENTT_NOEXCEPT;
     };
 
+    struct index_data {
+        std::unique_ptr<void, void(*)(void *)> index;
+        ENTT_ID_TYPE runtime_type;
+    };
+
     struct ctx_variable {
         std::unique_ptr<void, void(*)(void *)> value;
         ENTT_ID_TYPE runtime_type;
@@ -258,6 +293,36 @@ class basic_registry {
                 }
             };
 
+            pdata->mutable_get = nullptr;
+
+            if constexpr(!ENTT_ENABLE_ETO(Component)) {
+                // storage classes that don't offer write access (eg shared storage) only return const objects
+                if constexpr(!std::is_const_v<std::remove_pointer_t<decltype(std::declval<pool_type<Component> &>().try_get(std::declval<Entity>()))>>) {
+                    pdata->mutable_get = [](sparse_set<Entity> &cpool, const Entity entt) -> void * {
+                        return static_cast<pool_type<Component> &>(cpool).try_get(entt);
+                    };
+                }
+            }
+
+            // packed arrays can be accessed by position unless the storage tracks writes
+            if constexpr(!ENTT_ENABLE_ETO(Component) && std::is_base_of_v<basic_storage<Entity, Component>, pool_type<Component>>
+                    && !std::is_base_of_v<basic_tick_storage<Entity, Component>, pool_type<Component>>)
+            {
+                pdata->raw = [](const sparse_set<Entity> &cpool) -> const void * {
+                    return static_cast<const pool_type<Component> &>(cpool).raw();
+                };
+
+                pdata->mutable_raw = [](sparse_set<Entity> &cpool) -> void * {
+                    return static_cast<pool_type<Component> &>(cpool).raw();
+                };
+
+                pdata->stride = sizeof(Component);
+            } else {
+                pdata->raw = nullptr;
+                pdata->mutable_raw = nullptr;
+                pdata->stride = {};
+            }
+
             if constexpr(std::is_copy_constructible_v<std::decay_t<Component>>) {
                 pdata->assure = [](basic_registry &other, const sparse_set<Entity> &cpool) {
                     other.assure<Component>(static_cast<const pool_type<Component> &>(cpool));
@@ -281,6 +346,36 @@ class basic_registry {
         return const_cast<pool_type<Component> *>(std::as_const(*this).template assure<Component>());
     }
 
+    template<typename Term>
+    static void resolve(const basic_registry &owner, Term &term) {
+        const auto it = std::find_if(owner.pools.cbegin(), owner.pools.cend(), [ctype = to_integer(term.ctype)](const auto &pdata) {
+            return pdata.pool && pdata.runtime_type == ctype;
+        });
+
+        if(it != owner.pools.cend()) {
+            term.pool = it->pool.get();
+            term.stride = it->stride;
+
+            if constexpr(std::is_const_v<std::remove_pointer_t<decltype(term.pool)>>) {
+                term.get = it->get;
+                term.raw = it->raw;
+            } else {
+                // non-const queries go through the non-const functions of the storage classes
+                term.get = it->mutable_get;
+                term.raw = it->mutable_raw;
+            }
+        }
+    }
+
+    template<typename To, typename... Other, std::size_t... Index>
+    void respect(std::index_sequence<Index...>) {
+        // the last type is the one to use to sort, the ones before it are sorted
+        using list_type = std::tuple<Other...>;
+        auto *cpool = assure<To>();
+        ENTT_ASSERT(!cpool->super && (!assure<std::tuple_element_t<Index, list_type>>()->super && ...));
+        cpool->respect(*assure<std::tuple_element_t<sizeof...(Other) - 1u, list_type>>(), *assure<std::tuple_element_t<Index, list_type>>()...);
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -478,6 +573,76 @@ public:
         return assure<Component>()->data();
     }
 
+    /**
+     * @brief Returns the storage of a given type of component.
+     *
+     * This is mainly meant to access the functionalities of custom storage
+     * classes, as an example to request a checkpoint to a storage that keeps
+     * track of changes.
+     *
+     * @warning
+     * Assigning or removing components directly through the storage doesn't
+     * trigger signals and results in undefined behavior if the type is owned
+     * by a group.
+     *
+     * @tparam Component Type of component in which one is interested.
+     * @return The storage of the given type of component.
+     */
+    template<typename Component>
+    const storage<Entity, Component> & pool() const {
+        return *assure<Component>();
+    }
+
+    /*! @copydoc pool */
+    template<typename Component>
+    storage<Entity, Component> & pool() {
+        return *assure<Component>();
+    }
+
+    /**
+     * @brief Swaps the buffers of the storage of the given components.
+     *
+     * This function is meant for components stored in multiple buffers, so
+     * that they can be written and read at the same time. After a swap, what
+     * was written in the back buffers can be read from the front buffers.
+     *
+     * @sa basic_buffered_storage
+     *
+     * @warning
+     * Buffers must be swapped when no other thread is accessing the storage of
+     * the given components.
+     *
+     * @tparam Component Types of components of which to swap the buffers.
+     * @param refresh True to copy the front buffers to the back buffers, false
+     * otherwise.
+     */
+    template<typename... Component>
+    void swap_buffers(const bool refresh = false) {
+        (assure<Component>()->swap_buffers(refresh), ...);
+    }
+
+    /**
+     * @brief Restores the insertion order of the given components.
+     *
+     * This function is meant for components kept in a stable storage.
+     *
+     * @sa basic_stable_storage::compact
+     *
+     * @warning
+     * Pools of components owned by a group cannot be compacted.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * any of the pools is owned by a group.
+     *
+     * @tparam Component Types of components to compact.
+     */
+    template<typename... Component>
+    void compact() {
+        ([this](auto *cpool) {
+            ENTT_ASSERT(!cpool->super);
+            cpool->compact();
+        }(assure<Component>()), ...);
+    }
+
     /**
      * @brief Checks if an entity identifier refers to a valid entity.
      * @param entity An entity identifier, either valid or not.
@@ -860,6 +1025,74 @@ public:
         return assure<Component>()->replace(*this, entity, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Patches the given component for an entity.
+     *
+     * The signature of the functions should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Component &);
+     * @endcode
+     *
+     * The functions are applied in order to the instance already assigned to
+     * the entity, then listeners are notified. Unlike `replace`, no temporary
+     * object is created and listeners observe the component only once it has
+     * been updated.
+     *
+     * @note
+     * Empty types aren't explicitly instantiated and therefore they are never
+     * returned. However, this function can be used to trigger an update signal
+     * for them.
+     *
+     * @warning
+     * Attempting to use an invalid entity or to patch a component of an entity
+     * that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if the entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to patch.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entity A valid entity identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched component.
+     */
+    template<typename Component, typename... Func>
+    decltype(auto) patch(const entity_type entity, Func &&... func) {
+        ENTT_ASSERT(valid(entity));
+        return assure<Component>()->patch(*this, entity, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Patches the given component for multiple entities.
+     *
+     * @sa patch
+     *
+     * @warning
+     * Attempting to use an invalid entity or to patch a component of an entity
+     * that doesn't own it results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case of
+     * invalid entity or if an entity doesn't own an instance of the given
+     * component.
+     *
+     * @tparam Component Type of component to patch.
+     * @tparam It Type of forward iterator.
+     * @tparam Func Types of the function objects to invoke.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func Valid function objects.
+     */
+    template<typename Component, typename It, typename... Func>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>>
+    patch(It first, It last, Func &&... func) {
+        auto *cpool = assure<Component>();
+
+        for(; first != last; ++first) {
+            ENTT_ASSERT(valid(*first));
+            cpool->patch(*this, *first, func...);
+        }
+    }
+
     /**
      * @brief Assigns or replaces the given component for an entity.
      *
@@ -1220,6 +1453,36 @@ public:
         cpool->respect(*assure<From>());
     }
 
+    /**
+     * @brief Sorts multiple pools of components according to the order of the
+     * entities in another pool of components.
+     *
+     * The last of the given types is the one to use to sort, all the others
+     * are sorted. Therefore, `respect<To, From>` is equivalent to
+     * `sort<To, From>` and `respect<To, Other..., From>` is equivalent to a
+     * call to `sort<To, From>` for each of the types to sort. However, the
+     * entities of the pool of `To` are looked up in the pool of `From` only
+     * once and the resulting permutation is applied in turn to all the pools
+     * that contain the same entities in the same order, as it happens for
+     * example with components that are always assigned and sorted together.
+     *
+     * @sa sort
+     *
+     * @warning
+     * Pools of components owned by a group cannot be sorted.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * any of the pools is owned by a group.
+     *
+     * @tparam To Type of components to sort.
+     * @tparam Other Other types of components to sort, followed by the type of
+     * components to use to sort.
+     */
+    template<typename To, typename... Other>
+    void respect() {
+        static_assert(sizeof...(Other) != 0);
+        respect<To, Other...>(std::make_index_sequence<sizeof...(Other) ? (sizeof...(Other) - 1u) : 0u>{});
+    }
+
     /**
      * @brief Returns a view for the given components.
      *
@@ -1481,6 +1744,35 @@ public:
         return { std::move(selected) };
     }
 
+    /**
+     * @brief Returns a runtime query.
+     *
+     * Unlike runtime views, runtime queries are meant to be stored and reused.
+     * They are configured once with the lists of components to use to filter
+     * entities and don't allocate memory when iterated.
+     *
+     * @sa basic_runtime_query
+     *
+     * @return A newly created runtime query.
+     */
+    entt::basic_runtime_query<Entity> runtime_query() {
+        return { *this, &resolve<typename entt::basic_runtime_query<Entity>::term_type> };
+    }
+
+    /**
+     * @brief Returns a runtime query.
+     *
+     * Queries created by a const registry only give access to const
+     * components.
+     *
+     * @sa basic_runtime_query
+     *
+     * @return A newly created runtime query.
+     */
+    entt::basic_runtime_query<Entity, true> runtime_query() const {
+        return { *this, &resolve<typename entt::basic_runtime_query<Entity, true>::term_type> };
+    }
+
     /**
      * @brief Returns a full or partial copy of a registry.
      *
@@ -1670,6 +1962,60 @@ public:
         return { this, force };
     }
 
+    /**
+     * @brief Returns a secondary index of the given type.
+     *
+     * Indexes are created and connected to the registry the first time they
+     * are requested, then they are kept up to date through the signals of the
+     * registry for as long as it exists. The arguments provided are used to
+     * construct an index only if it doesn't exist yet.<br/>
+     * An index type must be constructible from a reference to a registry
+     * followed by the given arguments.
+     *
+     * @tparam Index Type of index to return.
+     * @tparam Args Types of arguments to use to construct the index.
+     * @param args Parameters to use to initialize the index.
+     * @return A reference to the index.
+     */
+    template<typename Index, typename... Args>
+    Index & index(Args &&... args) {
+        const auto itype = runtime_type<Index, index_family>();
+        auto it = std::find_if(indexes.begin(), indexes.end(), [itype](const auto &candidate) {
+            return candidate.runtime_type == itype;
+        });
+
+        if(it == indexes.end()) {
+            indexes.push_back({
+                decltype(index_data::index){new Index{*this, std::forward<Args>(args)...}, [](void *ptr) { delete static_cast<Index *>(ptr); }},
+                itype
+            });
+
+            it = std::prev(indexes.end());
+        }
+
+        return *static_cast<Index *>(it->index.get());
+    }
+
+    /**
+     * @brief Returns a hash index on a data member of a component.
+     *
+     * The index offers constant time lookups of the entities that own a given
+     * value for the data member.
+     *
+     * @sa basic_hash_index
+     *
+     * @note
+     * The definition of the index lives in a separate header that must be
+     * included to use this function.
+     *
+     * @tparam Member Data member of a component to use as a key.
+     * @return A reference to the index.
+     */
+    template<auto Member>
+    basic_hash_index<Entity, Member> & index() {
+        return index<basic_hash_index<Entity, Member>>();
+    }
+
     /**
      * @brief Binds an object to the context of the registry.
      *
@@ -1779,6 +2125,7 @@ public:
 private:
     mutable std::vector<pool_data> pools{};
     std::vector<group_data> groups{};
+    std::vector<index_data> indexes{};
     std::vector<ctx_variable> vars{};
     std::vector<entity_type> entities{};
     entity_type destroyed{null};
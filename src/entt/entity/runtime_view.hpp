@@ -2,13 +2,18 @@
 #define ENTT_ENTITY_RUNTIME_VIEW_HPP
 
 
+#include <chrono>
 #include <iterator>
+#include <limits>
 #include <vector>
+#include <numeric>
 #include <utility>
 #include <algorithm>
+#include <functional>
 #include <type_traits>
 #include "../config/config.h"
 #include "sparse_set.hpp"
+#include "utility.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 
@@ -244,11 +249,421 @@ public:
         std::for_each(begin(), end(), func);
     }
 
+    /**
+     * @brief Iterates entities for a limited number of candidates and applies
+     * the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided only with
+     * the entity itself. To get the components, users can use the registry
+     * with which the view was built.<br/>
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * At most `count` candidates are visited, starting from the given cursor.
+     *
+     * @sa cursor
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param count Maximum number of candidates to visit.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Func>
+    cursor each(const cursor from, const size_type count, Func func) const {
+        cursor next{0u, nullptr};
+
+        if(valid()) {
+            using difference_type = typename underlying_iterator_type::difference_type;
+            const auto &pool = *pools.front();
+            const auto last = (std::min)(from.next, pool.size());
+            const auto length = (std::min)(last, count);
+            const auto first = pool.end() - difference_type(last);
+            const auto * const *data = pools.data();
+            const iterator_type to{first + difference_type(length), first + difference_type(length), nullptr, nullptr};
+            std::for_each(iterator_type{first, first + difference_type(length), data + 1, data + pools.size()}, to, std::move(func));
+            next = cursor{last - length, &pool};
+        }
+
+        return next;
+    }
+
+    /**
+     * @brief Iterates entities until a deadline is reached and applies the
+     * given function object to them.
+     *
+     * The deadline is checked every `cursor::granularity` candidates. Apart
+     * from this, this function works exactly as its counterpart that accepts a
+     * maximum number of candidates.
+     *
+     * @sa cursor
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the time point.
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param deadline Point in time after which the iteration is suspended.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Clock, typename Duration, typename Func>
+    cursor each(cursor from, const std::chrono::time_point<Clock, Duration> deadline, Func func) const {
+        while(!from.done() && Clock::now() < deadline) {
+            from = each(from, cursor::granularity, std::ref(func));
+        }
+
+        return from;
+    }
+
 private:
     std::vector<const sparse_set<Entity> *> pools;
 };
 
 
+/**
+ * @brief Runtime query.
+ *
+ * A runtime query is a reusable runtime view. It's created once by a registry,
+ * configured with lists of component identifiers and then used as many times as
+ * needed without further allocations. Runtime queries support three lists of
+ * components:
+ *
+ * * All of: entities must have all the given components.
+ * * None of: entities mustn't have any of the given components.
+ * * Any of: entities must have at least one of the given components.
+ *
+ * Before every iteration, a runtime query picks up the smallest set of
+ * candidate entities and sorts the other pools so as to perform first the tests
+ * that are most likely to discard an entity.<br/>
+ * Pools that are missing when the query is configured are looked up again the
+ * next time the query is used, until they are created.
+ *
+ * @note
+ * Order of elements during iterations are highly dependent on the order of the
+ * underlying data structures. See sparse_set and its specializations for more
+ * details.
+ *
+ * @warning
+ * Lifetime of a query must overcome the one of the registry that generated it.
+ * In any other case, attempting to use a query results in undefined behavior.
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Const True if the query was created by a const registry and offers
+ * read-only access to the components, false otherwise.
+ */
+template<typename Entity, bool Const>
+class basic_runtime_query {
+    /*! @brief A registry is allowed to create queries. */
+    friend class basic_registry<Entity>;
+
+    using pool_type = std::conditional_t<Const, const sparse_set<Entity>, sparse_set<Entity>>;
+    using base_type = std::conditional_t<Const, const char, char>;
+    using instance_type = std::conditional_t<Const, const void, void>;
+
+    struct term_type {
+        component ctype;
+        pool_type *pool;
+        instance_type *(* get)(pool_type &, const Entity);
+        instance_type *(* raw)(pool_type &);
+        std::size_t stride;
+    };
+
+    using resolve_type = void(const basic_registry<Entity> &, term_type &);
+
+    basic_runtime_query(const basic_registry<Entity> &ref, resolve_type *func) ENTT_NOEXCEPT
+        : owner{&ref},
+          resolve{func}
+    {}
+
+    template<typename It>
+    static void assign(std::vector<term_type> &terms, It first, It last) {
+        terms.clear();
+
+        std::transform(first, last, std::back_inserter(terms), [](const component ctype) {
+            return term_type{ctype, nullptr, nullptr, nullptr, 0u};
+        });
+    }
+
+    const sparse_set<Entity> * lookup(const term_type &curr) const {
+        if(curr.pool) {
+            return curr.pool;
+        }
+
+        // pools created after the last iteration aren't cached by const functions
+        term_type other{curr.ctype, nullptr, nullptr, nullptr, 0u};
+        resolve(*owner, other);
+        return other.pool;
+    }
+
+    bool prepare() {
+        for(auto *terms: {&include, &exclude, &any}) {
+            for(auto &&curr: *terms) {
+                if(!curr.pool) {
+                    resolve(*owner, curr);
+                }
+            }
+        }
+
+        const auto valid = std::all_of(include.cbegin(), include.cend(), [](const auto &curr) {
+            return curr.pool;
+        });
+
+        if(valid) {
+            std::sort(probe.begin(), probe.end(), [this](const auto lhs, const auto rhs) {
+                return include[lhs].pool->size() < include[rhs].pool->size();
+            });
+
+            // pools that are more likely to contain a candidate come first
+            const auto larger = [](const auto &lhs, const auto &rhs) {
+                return (lhs.pool ? lhs.pool->size() : size_type{}) > (rhs.pool ? rhs.pool->size() : size_type{});
+            };
+
+            std::sort(exclude.begin(), exclude.end(), larger);
+            std::sort(any.begin(), any.end(), larger);
+
+            // flattens the pools to test so as to avoid indirections when iterating
+            filter.clear();
+            std::transform(probe.cbegin() + !probe.empty(), probe.cend(), std::back_inserter(filter), [this](const auto pos) { return include[pos].pool; });
+            extent[0] = filter.size();
+            std::for_each(exclude.cbegin(), exclude.cend(), [this](const auto &curr) { if(curr.pool) { filter.push_back(curr.pool); } });
+            extent[1] = filter.size();
+            std::for_each(any.cbegin(), any.cend(), [this](const auto &curr) { if(curr.pool) { filter.push_back(curr.pool); } });
+            extent[2] = filter.size();
+        }
+
+        return valid;
+    }
+
+    auto acceptor() const {
+        // local copies don't have to be reloaded when the function object has side effects
+        const auto * const *first = filter.data();
+        const auto * const *pivot = first + extent[0];
+        const auto * const *mid = first + extent[1];
+        const auto * const *last = first + extent[2];
+        const bool optional = any.empty();
+
+        return [first, pivot, mid, last, optional](const Entity entt) {
+            auto it = first;
+
+            for(; it != pivot; ++it) {
+                if(!(*it)->has(entt)) {
+                    return false;
+                }
+            }
+
+            for(; it != mid; ++it) {
+                if((*it)->has(entt)) {
+                    return false;
+                }
+            }
+
+            for(; it != last; ++it) {
+                if((*it)->has(entt)) {
+                    return true;
+                }
+            }
+
+            return optional;
+        };
+    }
+
+    template<typename Func>
+    void invoke(Func &func, const Entity entt, [[maybe_unused]] const std::size_t lead, [[maybe_unused]] const std::size_t pos) {
+        if constexpr(std::is_invocable_v<Func, entity_type, instance_type * const *>) {
+            for(size_type next{}, last = include.size(); next < last; ++next) {
+                const auto &curr = include[next];
+
+                if(bases[next]) {
+                    // the position of the entity within the leading pool is known already
+                    instances[next] = bases[next] + curr.stride * (next == lead ? pos : curr.pool->index(entt));
+                } else {
+                    instances[next] = curr.get ? curr.get(*curr.pool, entt) : nullptr;
+                }
+            }
+
+            func(entt, static_cast<instance_type * const *>(instances.data()));
+        } else {
+            func(entt);
+        }
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Sets the components that entities must have.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of components.
+     * @param last An iterator past the last element of the range of components.
+     * @return This query.
+     */
+    template<typename It>
+    basic_runtime_query & all_of(It first, It last) {
+        assign(include, first, last);
+        probe.resize(include.size());
+        std::iota(probe.begin(), probe.end(), size_type{});
+        instances.resize(include.size());
+        bases.resize(include.size());
+        return *this;
+    }
+
+    /**
+     * @brief Sets the components that entities mustn't have.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of components.
+     * @param last An iterator past the last element of the range of components.
+     * @return This query.
+     */
+    template<typename It>
+    basic_runtime_query & none_of(It first, It last) {
+        assign(exclude, first, last);
+        return *this;
+    }
+
+    /**
+     * @brief Sets the components of which entities must have at least one.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of components.
+     * @param last An iterator past the last element of the range of components.
+     * @return This query.
+     */
+    template<typename It>
+    basic_runtime_query & any_of(It first, It last) {
+        assign(any, first, last);
+        return *this;
+    }
+
+    /**
+     * @brief Estimates the number of entities returned by the query.
+     * @return Estimated number of entities returned by the query.
+     */
+    size_type size_hint() const {
+        size_type hint{};
+
+        if(include.empty()) {
+            for(auto &&curr: any) {
+                const auto *cpool = lookup(curr);
+                hint += cpool ? cpool->size() : size_type{};
+            }
+        } else {
+            hint = (std::numeric_limits<size_type>::max)();
+
+            for(auto &&curr: include) {
+                const auto *cpool = lookup(curr);
+                hint = (std::min)(hint, cpool ? cpool->size() : size_type{});
+            }
+        }
+
+        return hint;
+    }
+
+    /**
+     * @brief Checks if a query contains an entity.
+     * @param entt A valid entity identifier.
+     * @return True if the query contains the given entity, false otherwise.
+     */
+    bool contains(const entity_type entt) const {
+        const auto has = [entt, this](const auto &curr) {
+            const auto *cpool = lookup(curr);
+            return cpool && cpool->has(entt);
+        };
+
+        return !(include.empty() && any.empty())
+                && std::all_of(include.cbegin(), include.cend(), has)
+                && std::none_of(exclude.cbegin(), exclude.cend(), has)
+                && (any.empty() || std::any_of(any.cbegin(), any.cend(), has));
+    }
+
+    /**
+     * @brief Iterates entities and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided either
+     * only with the entity itself or also with an array of opaque pointers to
+     * its components, one for each of the components that entities must have
+     * and in the same order in which they were set. Pointers to instances of
+     * empty types are null. Queries created by a const registry only offer
+     * pointers to const components. Queries created by a non-const registry
+     * access components through the non-const functions of the storage classes
+     * instead, therefore pointers to components of storage classes that don't
+     * offer write access (for example, shared storage) are null.<br/>
+     * Whenever possible, pointers are computed from the position of the
+     * entities within the pools rather than by means of type-erased lookups.
+     * The signature of the function should be equivalent to one of the
+     * following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * void(const entity_type, const void * const *);
+     * void(const entity_type, void * const *);
+     * @endcode
+     *
+     * @warning
+     * Modifying components through the pointers doesn't trigger any signal.
+     *
+     * @warning
+     * A query sorts its pools and stores the pointers to the components before
+     * every iteration. Therefore, a query cannot be iterated from within the
+     * function object passed to its own `each` function nor by multiple
+     * threads at the same time. Use different queries in these cases.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        if(prepare()) {
+            const auto accept = acceptor();
+
+            if(probe.empty()) {
+                const auto first = filter.cbegin() + extent[1];
+
+                for(auto it = first, last = filter.cbegin() + extent[2]; it != last; ++it) {
+                    for(const auto entt: **it) {
+                        // entities shared with previous pools were already returned
+                        if(std::none_of(first, it, [entt](const auto *cpool) { return cpool->has(entt); }) && accept(entt)) {
+                            invoke(func, entt, include.size(), {});
+                        }
+                    }
+                }
+            } else {
+                const auto leading = probe.front();
+                const auto &lead = *include[leading].pool;
+
+                if constexpr(std::is_invocable_v<Func, entity_type, instance_type * const *>) {
+                    std::transform(include.cbegin(), include.cend(), bases.begin(), [](const auto &curr) {
+                        return curr.raw ? static_cast<base_type *>(curr.raw(*curr.pool)) : nullptr;
+                    });
+                }
+
+                for(auto pos = lead.size(); pos; --pos) {
+                    if(const auto entt = lead.data()[pos - 1u]; accept(entt)) {
+                        invoke(func, entt, leading, pos - 1u);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    const basic_registry<entity_type> *owner;
+    resolve_type *resolve;
+    std::vector<term_type> include{};
+    std::vector<term_type> exclude{};
+    std::vector<term_type> any{};
+    std::vector<size_type> probe{};
+    std::vector<const sparse_set<Entity> *> filter{};
+    size_type extent[3]{};
+    std::vector<base_type *> bases{};
+    std::vector<instance_type *> instances{};
+};
+
+
 }
 
 
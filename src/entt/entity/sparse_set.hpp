@@ -175,6 +175,31 @@ class sparse_set {
         return reverse[pos].get();
     }
 
+    template<typename It, typename Compare, typename Sort, typename... Args>
+    void order(It from, It to, Compare compare, Sort algo, Args &&... args) {
+        if constexpr(std::is_invocable_v<Compare, const entity_type>) {
+            // keys are extracted once and sorted along with their entities
+            std::vector<std::pair<std::decay_t<std::invoke_result_t<Compare, const entity_type>>, entity_type>> keys{};
+            keys.reserve(std::distance(from, to));
+
+            std::transform(from, to, std::back_inserter(keys), [&compare](const auto entt) {
+                return std::make_pair(compare(entt), entt);
+            });
+
+            const auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+
+            if constexpr(std::is_invocable_v<Sort, decltype(keys.begin()), decltype(keys.end()), decltype(by_key), Args...>) {
+                algo(keys.begin(), keys.end(), by_key, std::forward<Args>(args)...);
+            } else {
+                algo(keys.begin(), keys.end(), [](const auto &elem) { return elem.first; }, std::forward<Args>(args)...);
+            }
+
+            std::transform(keys.cbegin(), keys.cend(), from, [](const auto &elem) { return elem.second; });
+        } else {
+            algo(from, to, std::move(compare), std::forward<Args>(args)...);
+        }
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -368,6 +393,21 @@ public:
         return (curr < reverse.size() && reverse[curr] && reverse[curr][offset(entt)] != null);
     }
 
+    /**
+     * @brief Hints the processor to fetch the slot of an entity in advance.
+     *
+     * This function doesn't change the state of the sparse set. It's meant to
+     * hide the latency of the dependent loads of a later call to `has` or
+     * `index` for the same entity.
+     *
+     * @param entt A valid entity identifier.
+     */
+    void prefetch(const entity_type entt) const ENTT_NOEXCEPT {
+        if(const auto curr = page(entt); curr < reverse.size() && reverse[curr]) {
+            ENTT_PREFETCH(reverse[curr].get() + offset(entt));
+        }
+    }
+
     /**
      * @brief Returns the position of an entity in a sparse set.
      *
@@ -493,6 +533,18 @@ public:
      * * An iterator past the last element of the range to sort.
      * * A comparison function to use to compare the elements.
      *
+     * A projection can be provided in place of the comparison function. Its
+     * signature should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * Key(const Entity);
+     * @endcode
+     *
+     * In this case, keys are extracted once and sorted along with the entities,
+     * then the new order is applied in a single pass. Keys are compared with
+     * `operator<`, unless the sort function object accepts a _getter_ in place
+     * of the comparison function, as it happens with `radix_sort`.
+     *
      * @note
      * Attempting to iterate elements using a raw pointer returned by a call to
      * `data` gives no guarantees on the order, even though `sort` has been
@@ -517,7 +569,7 @@ public:
         const auto to = direct.rend() - skip;
         const auto from = to - length;
 
-        algo(from, to, std::move(compare), std::forward<Args>(args)...);
+        order(from, to, std::move(compare), std::move(algo), std::forward<Args>(args)...);
 
         for(size_type pos = skip, end = skip+length; pos < end; ++pos) {
             reverse[page(direct[pos])][offset(direct[pos])] = entity_type(pos);
@@ -561,7 +613,7 @@ public:
         const auto to = direct.rend() - skip;
         const auto from = to - length;
 
-        algo(from, to, std::move(compare), std::forward<Args>(args)...);
+        order(from, to, std::move(compare), std::move(algo), std::forward<Args>(args)...);
 
         for(size_type pos = skip, end = skip+length; pos < end; ++pos) {
             auto curr = pos;
@@ -616,6 +668,39 @@ public:
         }
     }
 
+    /**
+     * @brief Sort entities of multiple sparse sets according to their order
+     * in another sparse set.
+     *
+     * This sparse set and all the given ones are sorted as if `respect` was
+     * invoked on each of them in turn. However, the position in `other` of the
+     * entities of this set is looked up only once and the resulting permutation
+     * is applied to all the sets that contain the same entities in the same
+     * order, as it happens with pools that are assigned and sorted together on
+     * a regular basis. Sets that don't are sorted separately.
+     *
+     * @sa respect
+     *
+     * @tparam Other Types of sparse sets to sort along with this one.
+     * @param other The sparse sets that imposes the order of the entities.
+     * @param sets Sparse sets to sort along with this one.
+     */
+    template<typename... Other>
+    void respect(const sparse_set &other, Other &... sets) {
+        static_assert(std::conjunction_v<std::is_base_of<sparse_set, Other>...>);
+        const auto entities = shared(other);
+
+        ([&entities, &other, this](sparse_set &set) {
+            if(set.direct.size() == direct.size() && std::equal(direct.cbegin(), direct.cend(), set.direct.cbegin())) {
+                set.place(entities);
+            } else {
+                set.respect(other);
+            }
+        }(sets), ...);
+
+        place(entities);
+    }
+
     /**
      * @brief Resets a sparse set.
      */
@@ -625,6 +710,31 @@ public:
     }
 
 private:
+    std::vector<entity_type> shared(const sparse_set &other) const {
+        const auto last = other.size();
+        std::vector<entity_type> entities(last, entity_type{null});
+
+        // entities are put in the order in which other returns them
+        for(const auto entt: direct) {
+            if(other.has(entt)) {
+                entities[last - other.index(entt) - 1u] = entt;
+            }
+        }
+
+        entities.erase(std::remove(entities.begin(), entities.end(), null), entities.end());
+        return entities;
+    }
+
+    void place(const std::vector<entity_type> &entities) {
+        auto pos = direct.size();
+
+        for(const auto entt: entities) {
+            if(entt != direct[--pos]) {
+                swap(direct[pos], entt);
+            }
+        }
+    }
+
     std::vector<std::unique_ptr<entity_type[]>> reverse;
     std::vector<entity_type> direct;
 };
@@ -2,12 +2,17 @@
 #define ENTT_ENTITY_STORAGE_HPP
 
 
+#include <array>
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <type_traits>
+#include <unordered_map>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
 #include "sparse_set.hpp"
@@ -301,6 +306,22 @@ public:
         return const_cast<object_type *>(std::as_const(*this).try_get(entt));
     }
 
+    /**
+     * @brief Hints the processor to fetch the object of an entity in advance.
+     *
+     * This function doesn't change the state of the storage. It's meant to hide
+     * the latency of a later access to the object associated with an entity.
+     * The slot of the entity should be already in cache, otherwise the lookup
+     * itself stalls (see `sparse_set::prefetch` for that).
+     *
+     * @param entt A valid entity identifier.
+     */
+    void prefetch(const entity_type entt) const ENTT_NOEXCEPT {
+        if(underlying_type::has(entt)) {
+            ENTT_PREFETCH(instances.data() + underlying_type::index(entt));
+        }
+    }
+
     /**
      * @brief Assigns an entity to a storage and constructs its object.
      *
@@ -428,6 +449,18 @@ public:
      * * An iterator past the last element of the range to sort.
      * * A comparison function to use to compare the elements.
      *
+     * A projection can be provided in place of the comparison function. Its
+     * signature should be equivalent to one of the following:
+     *
+     * @code{.cpp}
+     * Key(const Entity);
+     * Key(const Type &);
+     * @endcode
+     *
+     * Keys are extracted once and sorted along with the entities, then objects
+     * are moved to their final positions in a single pass. See
+     * `sparse_set::sort` for more details.
+     *
      * @note
      * Attempting to iterate elements using a raw pointer returned by a call to
      * either `data` or `raw` gives no guarantees on the order, even though
@@ -454,7 +487,11 @@ public:
             std::swap(instances[underlying_type::index(lhs)], instances[underlying_type::index(rhs)]);
         };
 
-        if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto entt) {
+                return compare(std::as_const(instances[underlying_type::index(entt)]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
             underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
                 return compare(std::as_const(instances[underlying_type::index(lhs)]), std::as_const(instances[underlying_type::index(rhs)]));
             }, std::move(algo), std::forward<Args>(args)...);
@@ -709,6 +746,2113 @@ public:
     }
 };
 
+/**
+ * @brief Storage implementation that keeps track of changes.
+ *
+ * This class is a refinement of a basic storage that associates two ticks to
+ * each object: the one at which it was assigned to its entity and the one at
+ * which it was last accessed in a way that allows modifying it (through a
+ * non-const `get`, `try_get` or iterator). The ticks are packed and sorted the
+ * same of the objects. Moreover, the storage keeps the highest tick of every
+ * page of objects, so that queries can skip whole pages at once.<br/>
+ * The clock of a storage advances only when a checkpoint is requested. All
+ * the changes that occur after a checkpoint have a tick greater than the one
+ * returned by the checkpoint itself.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, transform>: entt::basic_tick_storage<entt::entity, transform> {};
+ * @endcode
+ *
+ * @note
+ * Writes through a pointer returned by `raw` aren't tracked. Use `touch` to
+ * mark objects as changed explicitly when needed.
+ *
+ * @warning
+ * Accessing objects in a way that allows modifying them isn't thread safe,
+ * even when the objects themselves are different, since pages are shared.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_tick_storage: public basic_storage<Entity, Type> {
+    static_assert(!ENTT_ENABLE_ETO(Type));
+
+    using underlying_type = basic_storage<Entity, Type>;
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+
+    static constexpr std::size_t page_size = 128u;
+
+    class iterator {
+        friend class basic_tick_storage<Entity, Type>;
+
+        using index_type = typename traits_type::difference_type;
+
+        iterator(basic_tick_storage *ref, const index_type idx) ENTT_NOEXCEPT
+            : owner{ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Type;
+        using pointer = value_type *;
+        using reference = value_type &;
+        using iterator_category = std::random_access_iterator_tag;
+
+        iterator() ENTT_NOEXCEPT = default;
+
+        iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        iterator operator++(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        iterator operator--(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return --(*this), orig;
+        }
+
+        iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return iterator{owner, index-value};
+        }
+
+        iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            return owner->stamp(size_type(index-value-1));
+        }
+
+        bool operator==(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        bool operator!=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        bool operator<(const iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        bool operator>(const iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        bool operator<=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        bool operator>=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        pointer operator->() const ENTT_NOEXCEPT {
+            return &owner->stamp(size_type(index-1));
+        }
+
+        reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        basic_tick_storage *owner;
+        index_type index;
+    };
+
+    Type & stamp(const std::size_t pos) ENTT_NOEXCEPT {
+        changes[pos] = current;
+        pages[pos / page_size] = current;
+        return underlying_type::raw()[pos];
+    }
+
+    void exchange(const std::size_t lhs, const std::size_t rhs) {
+        std::swap(additions[lhs], additions[rhs]);
+        std::swap(changes[lhs], changes[rhs]);
+        pages[lhs / page_size] = (std::max)(pages[lhs / page_size], changes[lhs]);
+        pages[rhs / page_size] = (std::max)(pages[rhs / page_size], changes[rhs]);
+    }
+
+    void grow(const std::size_t from) {
+        additions.resize(underlying_type::size(), current);
+        changes.resize(underlying_type::size(), current);
+        pages.resize((underlying_type::size() + page_size - 1u) / page_size);
+        std::fill(pages.begin() + from / page_size, pages.end(), current);
+    }
+
+    template<typename Func>
+    void visit(const std::vector<std::uint64_t> &ticks, const std::uint64_t since, Func func) const {
+        const auto *entities = underlying_type::data();
+
+        // iterates backwards like sparse sets do, skipping pages without changes
+        for(auto page = pages.size(); page; --page) {
+            if(pages[page - 1u] > since) {
+                for(auto pos = (std::min)(page * page_size, ticks.size()), first = (page - 1u) * page_size; pos > first; --pos) {
+                    if(ticks[pos - 1u] > since) {
+                        func(entities[pos - 1u]);
+                    }
+                }
+            }
+        }
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of the ticks of a storage. */
+    using tick_type = std::uint64_t;
+    /*! @brief Random access iterator type. */
+    using iterator_type = iterator;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator_type = typename underlying_type::const_iterator_type;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = std::reverse_iterator<iterator>;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        additions.reserve(cap);
+        changes.reserve(cap);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        additions.shrink_to_fit();
+        changes.shrink_to_fit();
+        pages.shrink_to_fit();
+    }
+
+    /*! @copydoc basic_storage::cbegin */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        return underlying_type::cbegin();
+    }
+
+    /*! @copydoc basic_storage::begin */
+    const_iterator_type begin() const ENTT_NOEXCEPT {
+        return underlying_type::cbegin();
+    }
+
+    /*! @copydoc basic_storage::begin */
+    iterator_type begin() ENTT_NOEXCEPT {
+        return iterator_type{this, typename traits_type::difference_type(underlying_type::size())};
+    }
+
+    /*! @copydoc basic_storage::cend */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return underlying_type::cend();
+    }
+
+    /*! @copydoc basic_storage::end */
+    const_iterator_type end() const ENTT_NOEXCEPT {
+        return underlying_type::cend();
+    }
+
+    /*! @copydoc basic_storage::end */
+    iterator_type end() ENTT_NOEXCEPT {
+        return iterator_type{this, {}};
+    }
+
+    /*! @copydoc basic_storage::get */
+    const object_type & get(const entity_type entt) const {
+        return underlying_type::get(entt);
+    }
+
+    /*! @copydoc basic_storage::get */
+    object_type & get(const entity_type entt) {
+        return stamp(underlying_type::index(entt));
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    const object_type * try_get(const entity_type entt) const {
+        return underlying_type::try_get(entt);
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    object_type * try_get(const entity_type entt) {
+        return underlying_type::has(entt) ? &stamp(underlying_type::index(entt)) : nullptr;
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename... Args>
+    object_type & construct(const entity_type entt, Args &&... args) {
+        underlying_type::construct(entt, std::forward<Args>(args)...);
+        grow(underlying_type::size() - 1u);
+        return underlying_type::raw()[underlying_type::size() - 1u];
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, Args &&... args) {
+        const auto from = underlying_type::size();
+        underlying_type::construct(first, last, std::forward<Args>(args)...);
+        grow(from);
+        return std::make_reverse_iterator(begin() + std::distance(first, last));
+    }
+
+    /*! @copydoc basic_storage::destroy */
+    void destroy(const entity_type entt) {
+        const auto pos = underlying_type::index(entt);
+        additions[pos] = additions.back();
+        changes[pos] = changes.back();
+        pages[pos / page_size] = (std::max)(pages[pos / page_size], changes[pos]);
+        additions.pop_back();
+        changes.pop_back();
+        pages.resize((changes.size() + page_size - 1u) / page_size);
+        underlying_type::destroy(entt);
+    }
+
+    /*! @copydoc basic_storage::swap */
+    void swap(const entity_type lhs, const entity_type rhs) override {
+        exchange(underlying_type::index(lhs), underlying_type::index(rhs));
+        underlying_type::swap(lhs, rhs);
+    }
+
+    /*! @copydoc basic_storage::sort */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(iterator_type first, iterator_type last, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_ASSERT(!(last < first));
+        ENTT_ASSERT(!(last > end()));
+
+        const auto from = sparse_set<Entity>::begin() + std::distance(begin(), first);
+        const auto to = from + std::distance(first, last);
+
+        const auto apply = [this](const auto lhs, const auto rhs) {
+            const auto lpos = underlying_type::index(lhs);
+            const auto rpos = underlying_type::index(rhs);
+            std::swap(underlying_type::raw()[lpos], underlying_type::raw()[rpos]);
+            exchange(lpos, rpos);
+        };
+
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto entt) {
+                return compare(std::as_const(underlying_type::raw()[underlying_type::index(entt)]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(underlying_type::raw()[underlying_type::index(lhs)]), std::as_const(underlying_type::raw()[underlying_type::index(rhs)]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /*! @copydoc basic_storage::reset */
+    void reset() {
+        underlying_type::reset();
+        additions.clear();
+        changes.clear();
+        pages.clear();
+    }
+
+    /**
+     * @brief Returns the current tick and advances the clock of a storage.
+     *
+     * All the objects assigned or changed after a checkpoint have ticks that
+     * are greater than the value returned by the checkpoint itself.
+     *
+     * @return The tick of the storage before the checkpoint.
+     */
+    tick_type checkpoint() ENTT_NOEXCEPT {
+        return current++;
+    }
+
+    /**
+     * @brief Marks the object associated with an entity as changed.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * storage doesn't contain the given entity.
+     *
+     * @param entt A valid entity identifier.
+     */
+    void touch(const entity_type entt) {
+        stamp(underlying_type::index(entt));
+    }
+
+    /**
+     * @brief Returns the tick at which an object was assigned to an entity.
+     * @param entt A valid entity identifier.
+     * @return The tick at which the object was assigned.
+     */
+    tick_type added(const entity_type entt) const {
+        return additions[underlying_type::index(entt)];
+    }
+
+    /**
+     * @brief Returns the tick at which an object was last changed.
+     * @param entt A valid entity identifier.
+     * @return The tick at which the object was last changed.
+     */
+    tick_type changed(const entity_type entt) const {
+        return changes[underlying_type::index(entt)];
+    }
+
+    /**
+     * @brief Iterates the entities whose objects changed after a given tick.
+     *
+     * The function object is invoked for each entity. Pages that didn't change
+     * since the given tick are skipped at once.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick returned by a previous checkpoint.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_changed(const tick_type since, Func func) const {
+        visit(changes, since, std::move(func));
+    }
+
+    /**
+     * @brief Iterates the entities whose objects were assigned after a given
+     * tick.
+     *
+     * @sa each_changed
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param since A tick returned by a previous checkpoint.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_added(const tick_type since, Func func) const {
+        // the tick of an addition never exceeds the one of the last change, pages are shared
+        visit(additions, since, std::move(func));
+    }
+
+private:
+    std::vector<tick_type> additions;
+    std::vector<tick_type> changes;
+    std::vector<tick_type> pages;
+    tick_type current{};
+};
+
+
+/**
+ * @brief Storage implementation that keeps objects in place.
+ *
+ * This class is an alternative to the basic storage for large objects. Objects
+ * are kept in a slab that is only rearranged when an object is removed and the
+ * last one in the slab takes its place. Along with the entities, the packed
+ * array contains the positions of the objects within the slab. Therefore, swapping elements (as it
+ * happens when sorting a storage or when a group arranges its pools) only
+ * exchanges two small handles rather than two objects.<br/>
+ * The price to pay is an extra indirection during iterations. Moreover, the
+ * order of the objects in the slab doesn't follow the one of the entities.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, physics>: entt::basic_indirect_storage<entt::entity, physics> {};
+ * @endcode
+ *
+ * @note
+ * Iterators and random access stay true to the order of the entities. Raw
+ * access gives instead no guarantees on the order.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_indirect_storage: public sparse_set<Entity> {
+    static_assert(!ENTT_ENABLE_ETO(Type));
+
+    using underlying_type = sparse_set<Entity>;
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+
+    template<bool Const>
+    class iterator {
+        friend class basic_indirect_storage<Entity, Type>;
+
+        using instance_type = std::conditional_t<Const, const std::vector<Type>, std::vector<Type>>;
+        using index_type = typename traits_type::difference_type;
+
+        iterator(instance_type *ref, const std::vector<std::size_t> *slots, const index_type idx) ENTT_NOEXCEPT
+            : instances{ref}, handles{slots}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Type;
+        using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+        using reference = std::conditional_t<Const, const value_type &, value_type &>;
+        using iterator_category = std::random_access_iterator_tag;
+
+        iterator() ENTT_NOEXCEPT = default;
+
+        iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        iterator operator++(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        iterator operator--(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return --(*this), orig;
+        }
+
+        iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return iterator{instances, handles, index-value};
+        }
+
+        iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return (*instances)[(*handles)[pos]];
+        }
+
+        bool operator==(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        bool operator!=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        bool operator<(const iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        bool operator>(const iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        bool operator<=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        bool operator>=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1);
+            return &(*instances)[(*handles)[pos]];
+        }
+
+        reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        instance_type *instances;
+        const std::vector<std::size_t> *handles;
+        index_type index;
+    };
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator_type = iterator<false>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator_type = iterator<true>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = std::reverse_iterator<iterator<false>>;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        instances.reserve(cap);
+        handles.reserve(cap);
+        owners.reserve(cap);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        instances.shrink_to_fit();
+        handles.shrink_to_fit();
+        owners.shrink_to_fit();
+    }
+
+    /**
+     * @brief Direct access to the slab of objects.
+     *
+     * The returned pointer is such that range `[raw(), raw() + size()]` is
+     * always a valid range, even if the container is empty.
+     *
+     * @note
+     * The order of the objects in the slab never follows the one of the
+     * entities. Use `begin` and `end` if you want to iterate the storage in the
+     * expected order.
+     *
+     * @return A pointer to the slab of objects.
+     */
+    const object_type * raw() const ENTT_NOEXCEPT {
+        return instances.data();
+    }
+
+    /*! @copydoc raw */
+    object_type * raw() ENTT_NOEXCEPT {
+        return const_cast<object_type *>(std::as_const(*this).raw());
+    }
+
+    /*! @copydoc basic_storage::cbegin */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator_type{&instances, &handles, pos};
+    }
+
+    /*! @copydoc cbegin */
+    const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    iterator_type begin() ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return iterator_type{&instances, &handles, pos};
+    }
+
+    /*! @copydoc basic_storage::cend */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return const_iterator_type{&instances, &handles, {}};
+    }
+
+    /*! @copydoc cend */
+    const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    iterator_type end() ENTT_NOEXCEPT {
+        return iterator_type{&instances, &handles, {}};
+    }
+
+    /*! @copydoc basic_storage::get */
+    const object_type & get(const entity_type entt) const {
+        return instances[handles[underlying_type::index(entt)]];
+    }
+
+    /*! @copydoc get */
+    object_type & get(const entity_type entt) {
+        return const_cast<object_type &>(std::as_const(*this).get(entt));
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    const object_type * try_get(const entity_type entt) const {
+        return underlying_type::has(entt) ? &instances[handles[underlying_type::index(entt)]] : nullptr;
+    }
+
+    /*! @copydoc try_get */
+    object_type * try_get(const entity_type entt) {
+        return const_cast<object_type *>(std::as_const(*this).try_get(entt));
+    }
+
+    /*! @copydoc basic_storage::prefetch */
+    void prefetch(const entity_type entt) const ENTT_NOEXCEPT {
+        if(underlying_type::has(entt)) {
+            ENTT_PREFETCH(instances.data() + handles[underlying_type::index(entt)]);
+        }
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename... Args>
+    object_type & construct(const entity_type entt, Args &&... args) {
+        if constexpr(std::is_aggregate_v<object_type>) {
+            instances.emplace_back(Type{std::forward<Args>(args)...});
+        } else {
+            instances.emplace_back(std::forward<Args>(args)...);
+        }
+
+        // entity goes after component in case constructor throws
+        underlying_type::construct(entt);
+        handles.push_back(instances.size() - 1u);
+        owners.push_back(entt);
+        return instances.back();
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, [[maybe_unused]] Args &&... args) {
+        const auto length = std::distance(first, last);
+
+        if constexpr(sizeof...(Args) == 0) {
+            instances.resize(instances.size() + length);
+        } else {
+            instances.resize(instances.size() + length, Type{std::forward<Args>(args)...});
+        }
+
+        // entity goes after component in case constructor throws
+        underlying_type::construct(first, last);
+
+        for(; first != last; ++first) {
+            handles.push_back(handles.size());
+            owners.push_back(*first);
+        }
+
+        return std::make_reverse_iterator(begin() + length);
+    }
+
+    /*! @copydoc basic_storage::destroy */
+    void destroy(const entity_type entt) {
+        const auto pos = underlying_type::index(entt);
+        const auto slot = handles[pos];
+        const auto other = owners.back();
+
+        // the last object of the slab fills the hole, its handle follows it
+        auto instance = std::move(instances.back());
+        instances[slot] = std::move(instance);
+        instances.pop_back();
+        owners[slot] = other;
+        owners.pop_back();
+        handles[underlying_type::index(other)] = slot;
+
+        handles[pos] = handles.back();
+        handles.pop_back();
+        underlying_type::destroy(entt);
+    }
+
+    /**
+     * @brief Swaps entities and handles in the internal packed arrays.
+     *
+     * Objects don't move, only their handles are swapped.
+     *
+     * @param lhs A valid entity identifier.
+     * @param rhs A valid entity identifier.
+     */
+    void swap(const entity_type lhs, const entity_type rhs) override {
+        std::swap(handles[underlying_type::index(lhs)], handles[underlying_type::index(rhs)]);
+        underlying_type::swap(lhs, rhs);
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * Objects don't move, only their handles are sorted.
+     *
+     * @sa basic_storage::sort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(iterator_type first, iterator_type last, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_ASSERT(!(last < first));
+        ENTT_ASSERT(!(last > end()));
+
+        const auto from = underlying_type::begin() + std::distance(begin(), first);
+        const auto to = from + std::distance(first, last);
+
+        const auto apply = [this](const auto lhs, const auto rhs) {
+            std::swap(handles[underlying_type::index(lhs)], handles[underlying_type::index(rhs)]);
+        };
+
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto entt) {
+                return compare(std::as_const(instances[handles[underlying_type::index(entt)]]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(instances[handles[underlying_type::index(lhs)]]), std::as_const(instances[handles[underlying_type::index(rhs)]]));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::arrange(from, to, std::move(apply), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /*! @brief Resets a storage. */
+    void reset() {
+        underlying_type::reset();
+        instances.clear();
+        handles.clear();
+        owners.clear();
+    }
+
+private:
+    std::vector<object_type> instances;
+    std::vector<size_type> handles;
+    std::vector<entity_type> owners;
+};
+
+
+/**
+ * @brief Storage implementation that can restore the insertion order.
+ *
+ * This class is a refinement of a basic storage that associates a sequence
+ * number to each object, that is the order in which it was assigned to its
+ * entity. Removing an object is still a constant time operation that moves the
+ * last element in the hole left behind, as it happens with the basic storage.
+ * However, the original order of the remaining elements can be restored at any
+ * time with a call to `compact`. This takes linear time, since sequence numbers
+ * are unique and bounded, and doesn't require to sort the storage.<br/>
+ * Therefore, calling `compact` before iterating a storage gives a
+ * deterministic order that depends only on the order of the insertions.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, body>: entt::basic_stable_storage<entt::entity, body> {};
+ * @endcode
+ *
+ * @note
+ * Sorting a storage or arranging it for a group changes the order of the
+ * elements. A call to `compact` restores the insertion order also in this
+ * case.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_stable_storage: public basic_storage<Entity, Type> {
+    static_assert(!ENTT_ENABLE_ETO(Type));
+
+    using underlying_type = basic_storage<Entity, Type>;
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator_type = typename underlying_type::iterator_type;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = typename underlying_type::reverse_iterator_type;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        sequence.reserve(cap);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        sequence.shrink_to_fit();
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename... Args>
+    object_type & construct(const entity_type entt, Args &&... args) {
+        auto &instance = underlying_type::construct(entt, std::forward<Args>(args)...);
+        sequence.push_back(next++);
+        return instance;
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, Args &&... args) {
+        auto it = underlying_type::construct(first, last, std::forward<Args>(args)...);
+        sequence.resize(underlying_type::size());
+        std::iota(sequence.end() - std::distance(first, last), sequence.end(), next);
+        next += std::distance(first, last);
+        return it;
+    }
+
+    /*! @copydoc basic_storage::destroy */
+    void destroy(const entity_type entt) {
+        const auto pos = underlying_type::index(entt);
+        stable = stable && (pos + 1u == sequence.size());
+        sequence[pos] = sequence.back();
+        sequence.pop_back();
+        underlying_type::destroy(entt);
+    }
+
+    /*! @copydoc basic_storage::swap */
+    void swap(const entity_type lhs, const entity_type rhs) override {
+        std::swap(sequence[underlying_type::index(lhs)], sequence[underlying_type::index(rhs)]);
+        underlying_type::swap(lhs, rhs);
+        stable = false;
+    }
+
+    /*! @copydoc basic_storage::sort */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(iterator_type first, iterator_type last, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_ASSERT(!(last < first));
+        ENTT_ASSERT(!(last > underlying_type::end()));
+
+        const auto from = sparse_set<Entity>::begin() + std::distance(underlying_type::begin(), first);
+        const auto to = from + std::distance(first, last);
+
+        const auto apply = [this](const auto lhs, const auto rhs) {
+            const auto lpos = underlying_type::index(lhs);
+            const auto rpos = underlying_type::index(rhs);
+            std::swap(underlying_type::raw()[lpos], underlying_type::raw()[rpos]);
+            std::swap(sequence[lpos], sequence[rpos]);
+        };
+
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto entt) {
+                return compare(std::as_const(underlying_type::get(entt)));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(std::as_const(underlying_type::get(lhs)), std::as_const(underlying_type::get(rhs)));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            sparse_set<Entity>::arrange(from, to, std::move(apply), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+
+        stable = false;
+    }
+
+    /*! @brief Resets a storage. */
+    void reset() {
+        underlying_type::reset();
+        sequence.clear();
+        stable = true;
+        next = {};
+    }
+
+    /**
+     * @brief Restores the insertion order of the elements of a storage.
+     *
+     * After a call to this function, the elements are packed in the order in
+     * which they were assigned to their entities, as if no element was ever
+     * removed from the storage. Iterating a storage returns them in reverse
+     * order, as it happens with any other storage.<br/>
+     * Sequence numbers are compacted in turn. Elements aren't moved if their
+     * order didn't change since the last call.
+     *
+     * @warning
+     * Pools of components owned by a group cannot be compacted, since the
+     * group relies on the order of their elements. Use `basic_registry::compact`
+     * to have it checked in debug mode.
+     */
+    void compact() {
+        if(!stable) {
+            // sequence numbers are unique and bounded, scattering them sorts the entities in linear time
+            std::vector<entity_type> order(next, entity_type(null));
+            const auto *entities = underlying_type::data();
+
+            for(size_type pos{}, last = sequence.size(); pos < last; ++pos) {
+                order[sequence[pos]] = entities[pos];
+            }
+
+            order.erase(std::remove_if(order.begin(), order.end(), [](const auto entt) { return entt == null; }), order.end());
+
+            for(size_type pos{}, last = order.size(); pos < last; ++pos) {
+                if(entities[pos] != order[pos]) {
+                    underlying_type::swap(entities[pos], order[pos]);
+                }
+            }
+
+            stable = true;
+        }
+
+        std::iota(sequence.begin(), sequence.end(), size_type{});
+        next = sequence.size();
+    }
+
+    /**
+     * @brief Returns the sequence number of the object of an entity.
+     *
+     * Sequence numbers reflect the order in which objects were assigned to
+     * their entities and are renumbered by `compact`.
+     *
+     * @param entt A valid entity identifier.
+     * @return The sequence number of the object assigned to the entity.
+     */
+    size_type rank(const entity_type entt) const {
+        return sequence[underlying_type::index(entt)];
+    }
+
+private:
+    std::vector<size_type> sequence;
+    size_type next{};
+    bool stable{true};
+};
+
+
+/**
+ * @brief Storage implementation that shares equal objects among entities.
+ *
+ * This class is an alternative to the basic storage for heavy objects that are
+ * likely to be the same for many entities. Objects are deduplicated and every
+ * distinct object is stored only once, along with the number of entities that
+ * refer to it. Along with the entities, the packed array contains references
+ * to the shared objects. Therefore, memory usage depends on the number of
+ * distinct objects rather than on the number of entities.<br/>
+ * Objects are compared by means of the given hash and equality functions.
+ * These can work on the whole object or on a key that identifies it, such as
+ * an explicit identifier.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, material>: entt::basic_shared_storage<entt::entity, material, material_hash> {};
+ * @endcode
+ *
+ * @note
+ * Shared objects can't be modified in place, since this would affect all the
+ * entities that refer to them. Only const references are returned and objects
+ * are changed by replacing them.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam Hash Type of hash function object for the objects.
+ * @tparam Equal Type of equality function object for the objects.
+ */
+template<typename Entity, typename Type, typename Hash = std::hash<Type>, typename Equal = std::equal_to<Type>>
+class basic_shared_storage: public sparse_set<Entity> {
+    static_assert(!ENTT_ENABLE_ETO(Type));
+
+    using underlying_type = sparse_set<Entity>;
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+    using instance_map = std::unordered_map<Type, std::size_t, Hash, Equal>;
+    using instance_type = typename instance_map::value_type;
+
+    class iterator {
+        friend class basic_shared_storage<Entity, Type, Hash, Equal>;
+
+        using index_type = typename traits_type::difference_type;
+
+        iterator(const std::vector<instance_type *> *ref, const index_type idx) ENTT_NOEXCEPT
+            : handles{ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+        using iterator_category = std::random_access_iterator_tag;
+
+        iterator() ENTT_NOEXCEPT = default;
+
+        iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        iterator operator++(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        iterator operator--(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return --(*this), orig;
+        }
+
+        iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return iterator{handles, index-value};
+        }
+
+        iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return (*handles)[pos]->first;
+        }
+
+        bool operator==(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        bool operator!=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        bool operator<(const iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        bool operator>(const iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        bool operator<=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        bool operator>=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1);
+            return &(*handles)[pos]->first;
+        }
+
+        reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        const std::vector<instance_type *> *handles;
+        index_type index;
+    };
+
+    instance_type * acquire(Type value) {
+        // references to the elements of an unordered map survive rehashing
+        auto *instance = &*instances.try_emplace(std::move(value), std::size_t{}).first;
+        ++instance->second;
+        return instance;
+    }
+
+    void release(instance_type *instance) {
+        if(!--instance->second) {
+            instances.erase(instances.find(instance->first));
+        }
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator_type = iterator;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator_type = iterator;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = std::reverse_iterator<iterator>;
+
+    /*! @brief Default constructor. */
+    basic_shared_storage() = default;
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    basic_shared_storage(const basic_shared_storage &other)
+        : underlying_type{other},
+          instances{other.instances},
+          handles{}
+    {
+        handles.reserve(other.handles.size());
+
+        for(const auto *instance: other.handles) {
+            handles.push_back(&*instances.find(instance->first));
+        }
+    }
+
+    /*! @brief Default move constructor. */
+    basic_shared_storage(basic_shared_storage &&) = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This storage.
+     */
+    basic_shared_storage & operator=(const basic_shared_storage &other) {
+        return (*this = basic_shared_storage{other});
+    }
+
+    /*! @brief Default move assignment operator. @return This storage. */
+    basic_shared_storage & operator=(basic_shared_storage &&) = default;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+        handles.reserve(cap);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+        handles.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the number of distinct objects in a storage.
+     * @return Number of distinct objects.
+     */
+    size_type unique() const ENTT_NOEXCEPT {
+        return instances.size();
+    }
+
+    /*! @copydoc basic_storage::cbegin */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator_type{&handles, pos};
+    }
+
+    /*! @copydoc cbegin */
+    const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /*! @copydoc basic_storage::cend */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return const_iterator_type{&handles, {}};
+    }
+
+    /*! @copydoc cend */
+    const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /*! @copydoc basic_storage::get */
+    const object_type & get(const entity_type entt) const {
+        return handles[underlying_type::index(entt)]->first;
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    const object_type * try_get(const entity_type entt) const {
+        return underlying_type::has(entt) ? &handles[underlying_type::index(entt)]->first : nullptr;
+    }
+
+    /**
+     * @brief Returns the number of entities that share the object of an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * storage doesn't contain the given entity.
+     *
+     * @param entt A valid entity identifier.
+     * @return The number of entities that refer to the same object.
+     */
+    size_type use_count(const entity_type entt) const {
+        return handles[underlying_type::index(entt)]->second;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * If an equal object already exists, the entity refers to it and the new
+     * object is discarded.
+     *
+     * @sa basic_storage::construct
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return The object associated with the entity.
+     */
+    template<typename... Args>
+    const object_type & construct(const entity_type entt, Args &&... args) {
+        instance_type *instance = nullptr;
+
+        if constexpr(std::is_aggregate_v<object_type>) {
+            instance = acquire(Type{std::forward<Args>(args)...});
+        } else {
+            instance = acquire(Type(std::forward<Args>(args)...));
+        }
+
+        // entity goes after component in case constructor throws
+        underlying_type::construct(entt);
+        handles.push_back(instance);
+        return instance->first;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and makes all of them
+     * refer to the same object.
+     *
+     * @sa basic_storage::construct
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to construct an object for the entities.
+     * @return An iterator to the list of objects just created and sorted the
+     * same of the entities.
+     */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, Args &&... args) {
+        const auto length = std::distance(first, last);
+
+        if(length) {
+            instance_type *instance = nullptr;
+
+            if constexpr(std::is_aggregate_v<object_type>) {
+                instance = acquire(Type{std::forward<Args>(args)...});
+            } else {
+                instance = acquire(Type(std::forward<Args>(args)...));
+            }
+
+            instance->second += length - 1u;
+            // entity goes after component in case constructor throws
+            underlying_type::construct(first, last);
+            handles.insert(handles.end(), length, instance);
+        }
+
+        return std::make_reverse_iterator(begin() + length);
+    }
+
+    /**
+     * @brief Replaces the object of an entity.
+     *
+     * The entity stops referring to its object, that is destroyed if no other
+     * entities refer to it. Then the entity refers to an object equal to the
+     * given one.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode if the
+     * storage doesn't contain the given entity.
+     *
+     * @param entt A valid entity identifier.
+     * @param value The new object for the entity.
+     * @return The object associated with the entity.
+     */
+    const object_type & replace(const entity_type entt, object_type value) {
+        auto *instance = acquire(std::move(value));
+        auto &handle = handles[underlying_type::index(entt)];
+        release(std::exchange(handle, instance));
+        return instance->first;
+    }
+
+    /*! @copydoc basic_storage::destroy */
+    void destroy(const entity_type entt) {
+        const auto pos = underlying_type::index(entt);
+        release(handles[pos]);
+        handles[pos] = handles.back();
+        handles.pop_back();
+        underlying_type::destroy(entt);
+    }
+
+    /**
+     * @brief Swaps entities and references in the internal packed arrays.
+     *
+     * Objects don't move, only references to them are swapped.
+     *
+     * @param lhs A valid entity identifier.
+     * @param rhs A valid entity identifier.
+     */
+    void swap(const entity_type lhs, const entity_type rhs) override {
+        std::swap(handles[underlying_type::index(lhs)], handles[underlying_type::index(rhs)]);
+        underlying_type::swap(lhs, rhs);
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * Objects don't move, only references to them are sorted.
+     *
+     * @sa basic_storage::sort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(iterator_type first, iterator_type last, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_ASSERT(!(last < first));
+        ENTT_ASSERT(!(last > end()));
+
+        const auto from = underlying_type::begin() + std::distance(begin(), first);
+        const auto to = from + std::distance(first, last);
+
+        const auto apply = [this](const auto lhs, const auto rhs) {
+            std::swap(handles[underlying_type::index(lhs)], handles[underlying_type::index(rhs)]);
+        };
+
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto entt) {
+                return compare(get(entt));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(get(lhs), get(rhs));
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::arrange(from, to, std::move(apply), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Makes entities that share an object adjacent to each other.
+     *
+     * Iterating a storage after a call to this function returns the entities
+     * grouped by object, so that batches of entities that share an object can
+     * be processed at once. There are no guarantees on the order of the
+     * batches.
+     */
+    void cluster() {
+        sort(begin(), end(), [this](const entity_type lhs, const entity_type rhs) {
+            return std::less<const instance_type *>{}(handles[underlying_type::index(lhs)], handles[underlying_type::index(rhs)]);
+        });
+    }
+
+    /**
+     * @brief Iterates the distinct objects of a storage.
+     *
+     * The function object is invoked for each distinct object. It is provided
+     * with the object and the number of entities that refer to it.<br/>
+     * The signature of the function must be equivalent to the following form:
+     *
+     * @code{.cpp}
+     * void(const object_type &, const size_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_unique(Func func) const {
+        for(auto &&instance: instances) {
+            func(instance.first, instance.second);
+        }
+    }
+
+    /*! @brief Resets a storage. */
+    void reset() {
+        underlying_type::reset();
+        instances.clear();
+        handles.clear();
+    }
+
+private:
+    instance_map instances;
+    std::vector<instance_type *> handles;
+};
+
+
+/**
+ * @brief Storage implementation with multiple buffers of objects.
+ *
+ * This class is an alternative to the basic storage for objects that are
+ * written by a thread and read by another one at the same time, as it happens
+ * with transforms shared by a simulation and a renderer. The storage keeps `N`
+ * buffers of objects, all of them packed and sorted the same of the entities.
+ * The _back_ buffer is the one in which objects are written. The _front_
+ * buffer is the one that was written before the last swap and is meant to be
+ * read.<br/>
+ * Non-const member functions work with the back buffer, const member functions
+ * with the front buffer. Therefore, views and groups that request a component
+ * as const read the front buffer, all the others read and write the back
+ * buffer.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, transform>: entt::basic_buffered_storage<entt::entity, transform> {};
+ * @endcode
+ *
+ * Swapping buffers is a constant time operation and doesn't copy any object.
+ * Therefore, after a swap the back buffer contains the objects it had the last
+ * time it was the back buffer, that is `N` swaps before. Writers are expected
+ * either to overwrite the back buffer as a whole or to read the front buffer
+ * and write the back one. Otherwise, the objects of the front buffer can be
+ * copied explicitly to the back buffer when swapping, at the cost of a full
+ * copy.
+ *
+ * @warning
+ * Structural changes (assigning or removing objects, sorting and so on) affect
+ * all the buffers at once. They must occur when no other thread is accessing
+ * the storage, as well as swaps.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ * @tparam N Number of buffers, at least two.
+ */
+template<typename Entity, typename Type, std::size_t N = 2u>
+class basic_buffered_storage: public sparse_set<Entity> {
+    static_assert(!ENTT_ENABLE_ETO(Type));
+    static_assert(N > 1u);
+
+    using underlying_type = sparse_set<Entity>;
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+
+    template<bool Const>
+    class iterator {
+        friend class basic_buffered_storage<Entity, Type, N>;
+
+        using instance_type = std::conditional_t<Const, const std::vector<Type>, std::vector<Type>>;
+        using index_type = typename traits_type::difference_type;
+
+        iterator(instance_type *ref, const index_type idx) ENTT_NOEXCEPT
+            : instances{ref}, index{idx}
+        {}
+
+    public:
+        using difference_type = index_type;
+        using value_type = Type;
+        using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+        using reference = std::conditional_t<Const, const value_type &, value_type &>;
+        using iterator_category = std::random_access_iterator_tag;
+
+        iterator() ENTT_NOEXCEPT = default;
+
+        iterator & operator++() ENTT_NOEXCEPT {
+            return --index, *this;
+        }
+
+        iterator operator++(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return ++(*this), orig;
+        }
+
+        iterator & operator--() ENTT_NOEXCEPT {
+            return ++index, *this;
+        }
+
+        iterator operator--(int) ENTT_NOEXCEPT {
+            iterator orig = *this;
+            return --(*this), orig;
+        }
+
+        iterator & operator+=(const difference_type value) ENTT_NOEXCEPT {
+            index -= value;
+            return *this;
+        }
+
+        iterator operator+(const difference_type value) const ENTT_NOEXCEPT {
+            return iterator{instances, index-value};
+        }
+
+        iterator & operator-=(const difference_type value) ENTT_NOEXCEPT {
+            return (*this += -value);
+        }
+
+        iterator operator-(const difference_type value) const ENTT_NOEXCEPT {
+            return (*this + -value);
+        }
+
+        difference_type operator-(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index - index;
+        }
+
+        reference operator[](const difference_type value) const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-value-1);
+            return (*instances)[pos];
+        }
+
+        bool operator==(const iterator &other) const ENTT_NOEXCEPT {
+            return other.index == index;
+        }
+
+        bool operator!=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this == other);
+        }
+
+        bool operator<(const iterator &other) const ENTT_NOEXCEPT {
+            return index > other.index;
+        }
+
+        bool operator>(const iterator &other) const ENTT_NOEXCEPT {
+            return index < other.index;
+        }
+
+        bool operator<=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this > other);
+        }
+
+        bool operator>=(const iterator &other) const ENTT_NOEXCEPT {
+            return !(*this < other);
+        }
+
+        pointer operator->() const ENTT_NOEXCEPT {
+            const auto pos = size_type(index-1);
+            return &(*instances)[pos];
+        }
+
+        reference operator*() const ENTT_NOEXCEPT {
+            return *operator->();
+        }
+
+    private:
+        instance_type *instances;
+        index_type index;
+    };
+
+    const std::vector<Type> & front() const ENTT_NOEXCEPT {
+        return buffers[(current + N - 1u) % N];
+    }
+
+    const std::vector<Type> & back() const ENTT_NOEXCEPT {
+        return buffers[current];
+    }
+
+    std::vector<Type> & back() ENTT_NOEXCEPT {
+        return buffers[current];
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Random access iterator type. */
+    using iterator_type = iterator<false>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator_type = iterator<true>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = std::reverse_iterator<iterator<false>>;
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        underlying_type::reserve(cap);
+
+        for(auto &&buffer: buffers) {
+            buffer.reserve(cap);
+        }
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        underlying_type::shrink_to_fit();
+
+        for(auto &&buffer: buffers) {
+            buffer.shrink_to_fit();
+        }
+    }
+
+    /**
+     * @brief Direct access to the front buffer of objects.
+     *
+     * @sa basic_storage::raw
+     *
+     * @return A pointer to the front buffer of objects.
+     */
+    const object_type * raw() const ENTT_NOEXCEPT {
+        return front().data();
+    }
+
+    /**
+     * @brief Direct access to the back buffer of objects.
+     *
+     * @sa basic_storage::raw
+     *
+     * @return A pointer to the back buffer of objects.
+     */
+    object_type * raw() {
+        return back().data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the front buffer.
+     * @sa basic_storage::cbegin
+     * @return An iterator to the first object of the front buffer.
+     */
+    const_iterator_type cbegin() const ENTT_NOEXCEPT {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return const_iterator_type{&front(), pos};
+    }
+
+    /*! @copydoc cbegin */
+    const_iterator_type begin() const ENTT_NOEXCEPT {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning of the back buffer.
+     * @sa basic_storage::begin
+     * @return An iterator to the first object of the back buffer.
+     */
+    iterator_type begin() {
+        const typename traits_type::difference_type pos = underlying_type::size();
+        return iterator_type{&back(), pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the front buffer.
+     * @sa basic_storage::cend
+     * @return An iterator to the element following the last object of the
+     * front buffer.
+     */
+    const_iterator_type cend() const ENTT_NOEXCEPT {
+        return const_iterator_type{&front(), {}};
+    }
+
+    /*! @copydoc cend */
+    const_iterator_type end() const ENTT_NOEXCEPT {
+        return cend();
+    }
+
+    /**
+     * @brief Returns an iterator to the end of the back buffer.
+     * @sa basic_storage::end
+     * @return An iterator to the element following the last object of the back
+     * buffer.
+     */
+    iterator_type end() {
+        return iterator_type{&back(), {}};
+    }
+
+    /**
+     * @brief Returns the object of an entity from the front buffer.
+     * @sa basic_storage::get
+     * @param entt A valid entity identifier.
+     * @return The object of the entity in the front buffer.
+     */
+    const object_type & get(const entity_type entt) const {
+        return front()[underlying_type::index(entt)];
+    }
+
+    /**
+     * @brief Returns the object of an entity from the back buffer.
+     * @sa basic_storage::get
+     * @param entt A valid entity identifier.
+     * @return The object of the entity in the back buffer.
+     */
+    object_type & get(const entity_type entt) {
+        return back()[underlying_type::index(entt)];
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    const object_type * try_get(const entity_type entt) const {
+        return underlying_type::has(entt) ? &get(entt) : nullptr;
+    }
+
+    /*! @copydoc basic_storage::try_get */
+    object_type * try_get(const entity_type entt) {
+        return underlying_type::has(entt) ? &get(entt) : nullptr;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * The object is constructed in the back buffer and copied to all the other
+     * buffers.
+     *
+     * @sa basic_storage::construct
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid entity identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return The object associated with the entity in the back buffer.
+     */
+    template<typename... Args>
+    object_type & construct(const entity_type entt, Args &&... args) {
+        auto &instances = back();
+
+        if constexpr(std::is_aggregate_v<object_type>) {
+            instances.emplace_back(Type{std::forward<Args>(args)...});
+        } else {
+            instances.emplace_back(std::forward<Args>(args)...);
+        }
+
+        for(auto &&buffer: buffers) {
+            if(&buffer != &instances) {
+                buffer.push_back(instances.back());
+            }
+        }
+
+        // entity goes after component in case constructor throws
+        underlying_type::construct(entt);
+        return instances.back();
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, [[maybe_unused]] Args &&... args) {
+        const auto length = std::distance(first, last);
+
+        for(auto &&buffer: buffers) {
+            if constexpr(sizeof...(Args) == 0) {
+                buffer.resize(buffer.size() + length);
+            } else {
+                buffer.resize(buffer.size() + length, Type{args...});
+            }
+        }
+
+        // entity goes after component in case constructor throws
+        underlying_type::construct(first, last);
+        return std::make_reverse_iterator(begin() + length);
+    }
+
+    /*! @copydoc basic_storage::destroy */
+    void destroy(const entity_type entt) {
+        const auto pos = underlying_type::index(entt);
+
+        for(auto &&buffer: buffers) {
+            auto other = std::move(buffer.back());
+            buffer[pos] = std::move(other);
+            buffer.pop_back();
+        }
+
+        underlying_type::destroy(entt);
+    }
+
+    /**
+     * @brief Swaps entities and objects in the internal packed arrays.
+     *
+     * Objects are swapped in all the buffers.
+     *
+     * @sa basic_storage::swap
+     *
+     * @param lhs A valid entity identifier.
+     * @param rhs A valid entity identifier.
+     */
+    void swap(const entity_type lhs, const entity_type rhs) override {
+        const auto lpos = underlying_type::index(lhs);
+        const auto rpos = underlying_type::index(rhs);
+
+        for(auto &&buffer: buffers) {
+            std::swap(buffer[lpos], buffer[rpos]);
+        }
+
+        underlying_type::swap(lhs, rhs);
+    }
+
+    /**
+     * @brief Sort elements according to the given comparison function.
+     *
+     * Objects are compared in the back buffer and moved in all the buffers.
+     *
+     * @sa basic_storage::sort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(iterator_type first, iterator_type last, Compare compare, Sort algo = Sort{}, Args &&... args) {
+        ENTT_ASSERT(!(last < first));
+        ENTT_ASSERT(!(last > end()));
+
+        const auto from = underlying_type::begin() + std::distance(begin(), first);
+        const auto to = from + std::distance(first, last);
+
+        const auto apply = [this](const auto lhs, const auto rhs) {
+            const auto lpos = underlying_type::index(lhs);
+            const auto rpos = underlying_type::index(rhs);
+
+            for(auto &&buffer: buffers) {
+                std::swap(buffer[lpos], buffer[rpos]);
+            }
+        };
+
+        if constexpr(std::is_invocable_v<Compare, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, &instances = std::as_const(*this).back(), compare = std::move(compare)](const auto entt) {
+                return compare(instances[underlying_type::index(entt)]);
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else if constexpr(std::is_invocable_v<Compare, const object_type &, const object_type &>) {
+            underlying_type::arrange(from, to, std::move(apply), [this, &instances = std::as_const(*this).back(), compare = std::move(compare)](const auto lhs, const auto rhs) {
+                return compare(instances[underlying_type::index(lhs)], instances[underlying_type::index(rhs)]);
+            }, std::move(algo), std::forward<Args>(args)...);
+        } else {
+            underlying_type::arrange(from, to, std::move(apply), std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        }
+    }
+
+    /*! @brief Resets a storage. */
+    void reset() {
+        underlying_type::reset();
+
+        for(auto &&buffer: buffers) {
+            buffer.clear();
+        }
+    }
+
+    /**
+     * @brief Swaps the buffers of a storage.
+     *
+     * The back buffer becomes the front buffer and the oldest buffer becomes
+     * the back buffer. By default, no objects are copied and the new back
+     * buffer contains the objects it had `N` swaps before. Otherwise, the
+     * objects of the new front buffer are copied to the new back buffer.
+     *
+     * @param refresh True to copy the front buffer to the back buffer, false
+     * otherwise.
+     */
+    void swap_buffers(const bool refresh = false) {
+        current = (current + 1u) % N;
+
+        if(refresh) {
+            std::copy(front().cbegin(), front().cend(), back().begin());
+        }
+    }
+
+private:
+    std::array<std::vector<object_type>, N> buffers;
+    size_type current{};
+};
+
+
+/**
+ * @brief Storage implementation for empty types that also indexes entities by
+ * means of a bitset.
+ *
+ * This class is a refinement of the basic storage for empty types, that is
+ * tags. Along with the sparse set, the storage keeps one bit per entity
+ * identifier that tells whether the entity has the tag. Bits are packed in
+ * words. Testing a bit is cheaper than a lookup in the sparse set and, more
+ * important, views that iterate only storage of this type intersect tags a
+ * word at a time rather than an entity at a time.
+ *
+ * The storage isn't used by default. To enable it for a given type, specialize
+ * the `storage` class template:
+ *
+ * @code{.cpp}
+ * template<>
+ * struct entt::storage<entt::entity, visible>: entt::basic_bitset_indexed_storage<entt::entity, visible> {};
+ * @endcode
+ *
+ * @warning
+ * This isn't a memory saving mode. The bitset is kept in addition to the sparse
+ * set, since the latter is shared by all storage classes and used by groups,
+ * runtime views and so on. Therefore, memory usage increases by one bit per
+ * entity identifier with respect to the basic storage.
+ *
+ * @sa basic_storage<Entity, Type>
+ *
+ * @tparam Entity A valid entity type (see entt_traits for more details).
+ * @tparam Type Type of objects assigned to the entities.
+ */
+template<typename Entity, typename Type>
+class basic_bitset_indexed_storage: public basic_storage<Entity, Type> {
+    static_assert(ENTT_ENABLE_ETO(Type));
+
+    using underlying_type = basic_storage<Entity, Type>;
+    using traits_type = entt_traits<std::underlying_type_t<Entity>>;
+
+    static auto position(const Entity entt) ENTT_NOEXCEPT {
+        return std::size_t(to_integer(entt) & traits_type::entity_mask);
+    }
+
+public:
+    /*! @brief Type of the objects associated with the entities. */
+    using object_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of the words of the bitset. */
+    using word_type = std::uint64_t;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator_type = typename underlying_type::reverse_iterator_type;
+
+    /*! @brief Number of bits in a word of the bitset. */
+    static constexpr size_type word_size = sizeof(word_type) * 8u;
+
+    /*! @copydoc basic_storage::construct */
+    template<typename... Args>
+    object_type construct(const entity_type entt, Args &&... args) {
+        auto instance = underlying_type::construct(entt, std::forward<Args>(args)...);
+        const auto pos = position(entt);
+
+        if(const auto curr = pos / word_size; !(curr < bits.size())) {
+            bits.resize(curr + 1u);
+        }
+
+        bits[pos / word_size] |= word_type{1} << (pos % word_size);
+        return instance;
+    }
+
+    /*! @copydoc basic_storage::construct */
+    template<typename It, typename... Args>
+    std::enable_if_t<std::is_same_v<typename std::iterator_traits<It>::value_type, entity_type>, reverse_iterator_type>
+    construct(It first, It last, Args &&... args) {
+        auto it = underlying_type::construct(first, last, std::forward<Args>(args)...);
+
+        for(; first != last; ++first) {
+            const auto pos = position(*first);
+
+            if(const auto curr = pos / word_size; !(curr < bits.size())) {
+                bits.resize(curr + 1u);
+            }
+
+            bits[pos / word_size] |= word_type{1} << (pos % word_size);
+        }
+
+        return it;
+    }
+
+    /**
+     * @brief Removes an entity from a storage.
+     *
+     * @sa sparse_set::destroy
+     *
+     * @param entt A valid entity identifier.
+     */
+    void destroy(const entity_type entt) {
+        const auto pos = position(entt);
+        bits[pos / word_size] &= ~(word_type{1} << (pos % word_size));
+        underlying_type::destroy(entt);
+    }
+
+    /**
+     * @brief Removes multiple entities from a storage.
+     *
+     * @sa destroy
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void destroy(It first, It last) {
+        for(; first != last; ++first) {
+            destroy(*first);
+        }
+    }
+
+    /**
+     * @brief Checks if a storage contains an entity.
+     *
+     * This function works exactly as `has`, but for the fact that it only
+     * tests a bit of the bitset.
+     *
+     * @param entt A valid entity identifier.
+     * @return True if the storage contains the given entity, false otherwise.
+     */
+    bool test(const entity_type entt) const ENTT_NOEXCEPT {
+        const auto pos = position(entt);
+        return (pos / word_size < bits.size()) && (bits[pos / word_size] & (word_type{1} << (pos % word_size)));
+    }
+
+    /**
+     * @brief Returns the number of words of the bitset.
+     * @return Number of words of the bitset.
+     */
+    size_type words() const ENTT_NOEXCEPT {
+        return bits.size();
+    }
+
+    /**
+     * @brief Returns a word of the bitset.
+     *
+     * Bit `N` of word `M` refers to the entity identifier of which the entity
+     * part is `M * word_size + N`. Words past the end of the bitset are empty.
+     *
+     * @param pos Position of the word to return.
+     * @return The requested word of the bitset.
+     */
+    word_type word(const size_type pos) const ENTT_NOEXCEPT {
+        return pos < bits.size() ? bits[pos] : word_type{};
+    }
+
+    /*! @brief Resets a storage. */
+    void reset() {
+        underlying_type::reset();
+        bits.clear();
+    }
+
+private:
+    std::vector<word_type> bits;
+};
+
+
 /*! @copydoc basic_storage */
 template<typename Entity, typename Type>
 struct storage: basic_storage<Entity, Type> {};
@@ -2,12 +2,69 @@
 #define ENTT_ENTITY_UTILITY_HPP
 
 
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+#include "../config/config.h"
 #include "../core/type_traits.hpp"
 
 
 namespace entt {
 
 
+/**
+ * @cond TURN_OFF_DOXYGEN
+ * Internal details not to be documented.
+ */
+
+
+namespace internal {
+
+
+template<typename Type, typename Reduce, typename Exec, typename Func>
+Type chunked_reduce(Type init, Reduce &reduce, const std::size_t count, const std::size_t chunk, Exec &exec, Func func) {
+    ENTT_ASSERT(chunk);
+    std::vector<std::optional<Type>> partial((count + chunk - 1u) / chunk);
+
+    exec(partial.size(), [&partial, &reduce, &func, count, chunk](const std::size_t pos) {
+        std::optional<Type> value{};
+
+        func(pos * chunk, (std::min)(count, pos * chunk + chunk), [&value, &reduce](auto &&curr) {
+            if(value) {
+                *value = reduce(std::move(*value), std::forward<decltype(curr)>(curr));
+            } else {
+                value.emplace(std::forward<decltype(curr)>(curr));
+            }
+        });
+
+        partial[pos] = std::move(value);
+    });
+
+    // partial results are always combined in the same order
+    for(auto &&value: partial) {
+        if(value) {
+            init = reduce(std::move(init), std::move(*value));
+        }
+    }
+
+    return init;
+}
+
+
+}
+
+
+/**
+ * Internal details not to be documented.
+ * @endcond TURN_OFF_DOXYGEN
+ */
+
+
 /**
  * @brief Alias for exclusion lists.
  * @tparam Type List of types.
@@ -40,6 +97,133 @@ template<typename... Type>
 constexpr get_t<Type...> get{};
 
 
+/**
+ * @brief Alias for prefetch distances.
+ * @tparam Distance Number of elements to look ahead during iterations.
+ */
+template<std::size_t Distance>
+struct lookahead_t: std::integral_constant<std::size_t, Distance> {};
+
+
+/**
+ * @brief Variable template for prefetch distances.
+ * @tparam Distance Number of elements to look ahead during iterations.
+ */
+template<std::size_t Distance>
+constexpr lookahead_t<Distance> lookahead{};
+
+
+/**
+ * @brief Alias for filters on the objects changed after a given tick.
+ * @tparam Type Type of component to which the filter applies.
+ */
+template<typename Type>
+struct changed_t {
+    /*! @brief Type of component to which the filter applies. */
+    using type = Type;
+    /*! @brief Tick returned by a previous checkpoint of the storage. */
+    std::uint64_t since;
+};
+
+
+/**
+ * @brief Alias for filters on the objects assigned after a given tick.
+ * @tparam Type Type of component to which the filter applies.
+ */
+template<typename Type>
+struct added_t {
+    /*! @brief Type of component to which the filter applies. */
+    using type = Type;
+    /*! @brief Tick returned by a previous checkpoint of the storage. */
+    std::uint64_t since;
+};
+
+
+/**
+ * @brief Creates a filter on the objects changed after a given tick.
+ * @tparam Type Type of component to which the filter applies.
+ * @param since Tick returned by a previous checkpoint of the storage.
+ * @return A properly initialized filter.
+ */
+template<typename Type>
+constexpr changed_t<Type> changed(const std::uint64_t since) ENTT_NOEXCEPT {
+    return changed_t<Type>{since};
+}
+
+
+/**
+ * @brief Creates a filter on the objects assigned after a given tick.
+ * @tparam Type Type of component to which the filter applies.
+ * @param since Tick returned by a previous checkpoint of the storage.
+ * @return A properly initialized filter.
+ */
+template<typename Type>
+constexpr added_t<Type> added(const std::uint64_t since) ENTT_NOEXCEPT {
+    return added_t<Type>{since};
+}
+
+
+/**
+ * @brief Resume token for iterations split over multiple calls.
+ *
+ * A default constructed cursor refers to the beginning of an iteration. Views
+ * and groups return a new cursor every time they are iterated by means of a
+ * cursor, so that the iteration can be resumed later on where it stopped.<br/>
+ * Cursors remain valid across structural changes. Iterations are performed
+ * from the back to the front of the underlying packed arrays, therefore
+ * entities added in the meantime are visited only after a restart, while an
+ * entity that is moved from the back into the hole left by a removal could be
+ * visited twice. In case the pools shrink, cursors are clamped and the
+ * iteration continues safely.
+ */
+class cursor {
+    template<typename...>
+    friend class basic_view;
+
+    template<typename...>
+    friend class basic_group;
+
+    template<typename>
+    friend class basic_runtime_view;
+
+    cursor(const std::size_t pos, const void *ref) ENTT_NOEXCEPT
+        : next{pos},
+          owner{ref}
+    {}
+
+public:
+    /*! @brief Number of candidates visited between two checks of a deadline. */
+    static constexpr std::size_t granularity = 64u;
+
+    /*! @brief Default constructor, a cursor to the beginning of an iteration. */
+    cursor() ENTT_NOEXCEPT
+        : next{(std::numeric_limits<std::size_t>::max)()},
+          owner{nullptr}
+    {}
+
+    /**
+     * @brief Checks if an iteration is completed.
+     * @return True if there are no more candidates to visit, false otherwise.
+     */
+    bool done() const ENTT_NOEXCEPT {
+        return !next;
+    }
+
+    /**
+     * @brief Returns the number of candidates left for the iteration, if known.
+     * @return The number of candidates left to visit, the maximum value of the
+     * size type if the iteration didn't start yet.
+     */
+    std::size_t remaining() const ENTT_NOEXCEPT {
+        return next;
+    }
+
+private:
+    std::size_t next;
+    const void *owner;
+};
+
+
 }
 
 
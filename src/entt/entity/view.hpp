@@ -5,10 +5,14 @@
 #include <iterator>
 #include <array>
 #include <tuple>
+#include <chrono>
+#include <functional>
+#include <numeric>
 #include <utility>
 #include <algorithm>
 #include <type_traits>
 #include "../config/config.h"
+#include "../core/algorithm.hpp"
 #include "../core/type_traits.hpp"
 #include "sparse_set.hpp"
 #include "storage.hpp"
@@ -81,6 +85,7 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> {
     using underlying_iterator_type = typename sparse_set<Entity>::iterator_type;
     using unchecked_type = std::array<const sparse_set<Entity> *, (sizeof...(Component) - 1)>;
     using filter_type = std::array<const sparse_set<Entity> *, sizeof...(Exclude)>;
+    using probe_type = std::array<std::pair<const sparse_set<Entity> *, bool>, (sizeof...(Component) + sizeof...(Exclude) - 1)>;
 
     class iterator {
         friend class basic_view<Entity, exclude_t<Exclude...>, Component...>;
@@ -170,13 +175,64 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> {
         }
     }
 
+    template<typename Comp, typename Filter, typename Func>
+    void filtered([[maybe_unused]] const Filter cond, [[maybe_unused]] Func &func) const {
+        if constexpr(std::is_same_v<std::remove_const_t<Comp>, typename Filter::type>) {
+            const auto apply = [this, &func](const auto entt) {
+                if(contains(entt)) {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Component>({}))...>) {
+                        func(std::get<pool_type<Component> *>(pools)->get(entt)...);
+                    } else {
+                        func(entt, std::get<pool_type<Component> *>(pools)->get(entt)...);
+                    }
+                }
+            };
+
+            if constexpr(std::is_same_v<Filter, changed_t<typename Filter::type>>) {
+                std::get<pool_type<Comp> *>(pools)->each_changed(cond.since, apply);
+            } else {
+                std::get<pool_type<Comp> *>(pools)->each_added(cond.since, apply);
+            }
+        }
+    }
+
+    template<typename Comp>
+    static constexpr bool is_bitset_v = std::is_base_of_v<basic_bitset_indexed_storage<Entity, std::remove_const_t<Comp>>, storage<Entity, std::remove_const_t<Comp>>>;
+
+    template<typename Func>
+    void intersect(Func func) const {
+        const sparse_set<Entity> *lead = std::get<0>(pools);
+        const auto last = std::min({ std::get<pool_type<Component> *>(pools)->words()... });
+
+        for(size_type pos{}; pos < last; ++pos) {
+            auto bits = (std::get<pool_type<Component> *>(pools)->word(pos) & ...);
+            bits = (bits & ... & ~std::get<pool_type<Exclude> *>(filter)->word(pos));
+
+            for(size_type bit{}; bits; ++bit, bits >>= 1u) {
+                if(bits & 1u) {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Component>({}))...>) {
+                        func(Component{}...);
+                    } else {
+                        const auto entt = lead->data()[lead->index(static_cast<entity_type>(pos * sizeof(bits) * 8u + bit))];
+                        func(entt, Component{}...);
+                    }
+                }
+            }
+        }
+    }
+
     template<typename Comp, typename Func, typename... Other, typename... Type>
     void traverse(Func func, type_list<Other...>, type_list<Type...>) const {
-        const auto end = std::get<pool_type<Comp> *>(pools)->sparse_set<Entity>::end();
-        auto begin = std::get<pool_type<Comp> *>(pools)->sparse_set<Entity>::begin();
+        const auto *cpool = std::get<pool_type<Comp> *>(pools);
+        traverse<Comp>(std::move(func), type_list<Other...>{}, type_list<Type...>{}, cpool->sparse_set<Entity>::begin(), cpool->sparse_set<Entity>::end());
+    }
 
+    template<typename Comp, typename Func, typename... Other, typename... Type>
+    void traverse(Func func, type_list<Other...>, type_list<Type...>, underlying_iterator_type begin, underlying_iterator_type end) const {
         if constexpr(std::disjunction_v<std::is_same<Comp, Type>...>) {
-            std::for_each(begin, end, [this, raw = std::get<pool_type<Comp> *>(pools)->begin(), &func](const auto entity) mutable {
+            const auto offset = begin - std::get<pool_type<Comp> *>(pools)->sparse_set<Entity>::begin();
+
+            std::for_each(begin, end, [this, raw = std::get<pool_type<Comp> *>(pools)->begin() + offset, &func](const auto entity) mutable {
                 auto curr = raw++;
 
                 if((std::get<pool_type<Other> *>(pools)->has(entity) && ...) && (!std::get<pool_type<Exclude> *>(filter)->has(entity) && ...)) {
@@ -200,6 +256,111 @@ class basic_view<Entity, exclude_t<Exclude...>, Component...> {
         }
     }
 
+    template<typename Comp, std::size_t Distance, typename Func, typename... Other, typename... Type>
+    void traverse(Func func, lookahead_t<Distance>, type_list<Other...>, type_list<Type...>) const {
+        const auto *cpool = std::get<pool_type<Comp> *>(pools);
+        const auto begin = cpool->sparse_set<Entity>::begin();
+        const auto last = cpool->sparse_set<Entity>::size();
+        [[maybe_unused]] auto raw = std::get<pool_type<Comp> *>(pools)->begin();
+
+        for(size_type pos{}; pos < last; ++pos) {
+            if(const auto next = pos + 2 * Distance; next < last) {
+                (std::get<pool_type<Other> *>(pools)->sparse_set<Entity>::prefetch(begin[next]), ...);
+                (std::get<pool_type<Exclude> *>(filter)->sparse_set<Entity>::prefetch(begin[next]), ...);
+            }
+
+            if(const auto next = pos + Distance; next < last) {
+                (std::get<pool_type<Other> *>(pools)->prefetch(begin[next]), ...);
+            }
+
+            const auto entity = begin[pos];
+
+            if((std::get<pool_type<Other> *>(pools)->has(entity) && ...) && (!std::get<pool_type<Exclude> *>(filter)->has(entity) && ...)) {
+                if constexpr(std::disjunction_v<std::is_same<Comp, Type>...>) {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Type>({}))...>) {
+                        func(get<Comp, Type>(raw + pos, std::get<pool_type<Type> *>(pools), entity)...);
+                    } else {
+                        func(entity, get<Comp, Type>(raw + pos, std::get<pool_type<Type> *>(pools), entity)...);
+                    }
+                } else {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Type>({}))...>) {
+                        func(std::get<pool_type<Type> *>(pools)->get(entity)...);
+                    } else {
+                        func(entity, std::get<pool_type<Type> *>(pools)->get(entity)...);
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename Comp, typename Func, typename... Type>
+    void traverse(Func func, const probe_type &probes, type_list<Type...>) const {
+        const auto end = std::get<pool_type<Comp> *>(pools)->sparse_set<Entity>::end();
+        auto begin = std::get<pool_type<Comp> *>(pools)->sparse_set<Entity>::begin();
+
+        const auto accept = [&probes](const auto entity) {
+            return std::all_of(probes.cbegin(), probes.cend(), [entity](const auto &probe) {
+                return probe.first->has(entity) != probe.second;
+            });
+        };
+
+        if constexpr(std::disjunction_v<std::is_same<Comp, Type>...>) {
+            std::for_each(begin, end, [this, raw = std::get<pool_type<Comp> *>(pools)->begin(), &func, &accept](const auto entity) mutable {
+                auto curr = raw++;
+
+                if(accept(entity)) {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Type>({}))...>) {
+                        func(get<Comp, Type>(curr, std::get<pool_type<Type> *>(pools), entity)...);
+                    } else {
+                        func(entity, get<Comp, Type>(curr, std::get<pool_type<Type> *>(pools), entity)...);
+                    }
+                }
+            });
+        } else {
+            std::for_each(begin, end, [this, &func, &accept](const auto entity) {
+                if(accept(entity)) {
+                    if constexpr(std::is_invocable_v<Func, decltype(get<Type>({}))...>) {
+                        func(std::get<pool_type<Type> *>(pools)->get(entity)...);
+                    } else {
+                        func(entity, std::get<pool_type<Type> *>(pools)->get(entity)...);
+                    }
+                }
+            });
+        }
+    }
+
+    template<typename Comp, typename Type, typename Reduce, typename Transform, typename Exec>
+    Type chunked(Type init, Reduce &reduce, Transform &transform, const std::size_t chunk, Exec &exec) const {
+        using other_type = type_list_cat_t<std::conditional_t<std::is_same_v<Comp, Component>, type_list<>, type_list<Component>>...>;
+        using difference_type = typename underlying_iterator_type::difference_type;
+        const auto *cpool = std::get<pool_type<Comp> *>(pools);
+
+        return internal::chunked_reduce(std::move(init), reduce, cpool->size(), chunk, exec, [this, cpool, &transform](const auto first, const auto last, auto fold) {
+            const auto begin = cpool->sparse_set<Entity>::begin();
+
+            if constexpr(std::is_invocable_v<Transform, decltype(get<Component>({}))...>) {
+                traverse<Comp>([&transform, &fold](auto &&... curr) -> void {
+                    fold(transform(std::forward<decltype(curr)>(curr)...));
+                }, other_type{}, type_list<Component...>{}, begin + difference_type(first), begin + difference_type(last));
+            } else {
+                traverse<Comp>([&transform, &fold](const entity_type entt, auto &&... curr) -> void {
+                    fold(transform(entt, std::forward<decltype(curr)>(curr)...));
+                }, other_type{}, type_list<Component...>{}, begin + difference_type(first), begin + difference_type(last));
+            }
+        });
+    }
+
+    template<typename Comp, typename Func>
+    cursor resume(const cursor from, const std::size_t count, Func func) const {
+        using other_type = type_list_cat_t<std::conditional_t<std::is_same_v<Comp, Component>, type_list<>, type_list<Component>>...>;
+        const auto *cpool = std::get<pool_type<Comp> *>(pools);
+        const auto last = (std::min)(from.next, cpool->size());
+        const auto length = (std::min)(last, count);
+        const auto first = cpool->sparse_set<Entity>::end() - typename underlying_iterator_type::difference_type(last);
+        traverse<Comp>(std::move(func), other_type{}, type_list<Component...>{}, first, first + typename underlying_iterator_type::difference_type(length));
+        return cursor{last - length, cpool};
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = Entity;
@@ -207,6 +368,8 @@ public:
     using size_type = std::size_t;
     /*! @brief Input iterator type. */
     using iterator_type = iterator;
+    /*! @brief Type of execution plans returned by the planner. */
+    using plan_type = std::array<size_type, (sizeof...(Component) + sizeof...(Exclude))>;
 
     /**
      * @brief Returns the number of existing components of the given type.
@@ -402,13 +565,21 @@ public:
      * are returned during iterations. They can be caught only by copy or with
      * const references.
      *
+     * If all the components and the excluded types are backed by a bitset
+     * storage, the view intersects their bitsets a word at a time instead. In
+     * this case, entities are returned in ascending order of identifier.
+     *
      * @tparam Func Type of the function object to invoke.
      * @param func A valid function object.
      */
     template<typename Func>
     void each(Func func) const {
-        const auto *view = candidate();
-        ((std::get<pool_type<Component> *>(pools) == view ? each<Component>(std::move(func)) : void()), ...);
+        if constexpr((is_bitset_v<Component> && ...) && (is_bitset_v<Exclude> && ...)) {
+            intersect(std::move(func));
+        } else {
+            const auto *view = candidate();
+            ((std::get<pool_type<Component> *>(pools) == view ? each<Component>(std::move(func)) : void()), ...);
+        }
     }
 
     /**
@@ -447,6 +618,330 @@ public:
         traverse<Comp>(std::move(func), other_type{}, type_list<Component...>{});
     }
 
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, if a given component changed after a checkpoint.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * void(Component &...);
+     * @endcode
+     *
+     * The pool of the filtered component is used to lead the iterations and it
+     * must be a storage that keeps track of changes.
+     *
+     * @sa basic_tick_storage
+     *
+     * @tparam Type Type of component to which the filter applies.
+     * @tparam Func Type of the function object to invoke.
+     * @param cond A filter created with `changed`.
+     * @param func A valid function object.
+     */
+    template<typename Type, typename Func>
+    void each(const changed_t<Type> cond, Func func) const {
+        static_assert(std::disjunction_v<std::is_same<std::remove_const_t<Component>, Type>...>);
+        (filtered<Component>(cond, func), ...);
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, if a given component was assigned after a checkpoint.
+     *
+     * @sa each
+     *
+     * @tparam Type Type of component to which the filter applies.
+     * @tparam Func Type of the function object to invoke.
+     * @param cond A filter created with `added`.
+     * @param func A valid function object.
+     */
+    template<typename Type, typename Func>
+    void each(const added_t<Type> cond, Func func) const {
+        static_assert(std::disjunction_v<std::is_same<std::remove_const_t<Component>, Type>...>);
+        (filtered<Component>(cond, func), ...);
+    }
+
+    /**
+     * @brief Iterates entities and components for a limited number of
+     * candidates and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * void(Component &...);
+     * @endcode
+     *
+     * At most `count` candidates are visited, starting from the given cursor.
+     * The pool that leads the iterations is chosen when the iteration starts
+     * and it's tied to the returned cursor, so that the iteration continues on
+     * the same pool when resumed.
+     *
+     * @sa cursor
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param count Maximum number of candidates to visit.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Func>
+    cursor each(const cursor from, const size_type count, Func func) const {
+        const void *view = from.owner;
+
+        if(((view != std::get<pool_type<Component> *>(pools)) && ...)) {
+            view = candidate();
+        }
+
+        cursor next{0u, view};
+        ((std::get<pool_type<Component> *>(pools) == view ? (next = resume<Component>(from, count, std::move(func)), void()) : void()), ...);
+        return next;
+    }
+
+    /**
+     * @brief Iterates entities and components until a deadline is reached and
+     * applies the given function object to them.
+     *
+     * The deadline is checked every `cursor::granularity` candidates. Apart
+     * from this, this function works exactly as its counterpart that accepts a
+     * maximum number of candidates.
+     *
+     * @sa cursor
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the time point.
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param deadline Point in time after which the iteration is suspended.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Clock, typename Duration, typename Func>
+    cursor each(cursor from, const std::chrono::time_point<Clock, Duration> deadline, Func func) const {
+        while(!from.done() && Clock::now() < deadline) {
+            from = each(from, cursor::granularity, std::ref(func));
+        }
+
+        return from;
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, prefetching data for the entities that come next.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * void(Component &...);
+     * @endcode
+     *
+     * Iterations are pipelined. The slots of the entity that is `2 * Distance`
+     * positions ahead are prefetched from the sparse arrays of all the other
+     * pools, while the instances of the entity that is `Distance` positions
+     * ahead are prefetched from the pools of the components.<br/>
+     * This is meant for views over pools that don't fit in cache, where
+     * dependent loads are the main source of stalls. In all other cases, the
+     * plain `each` member function is likely faster.
+     *
+     * @note
+     * Empty types aren't explicitly instantiated. Therefore, temporary objects
+     * are returned during iterations. They can be caught only by copy or with
+     * const references.
+     *
+     * @tparam Distance Number of entities to look ahead.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<std::size_t Distance, typename Func>
+    void each(lookahead_t<Distance>, Func func) const {
+        static_assert(Distance != 0);
+        const auto *view = candidate();
+
+        ((std::get<pool_type<Component> *>(pools) == view ? each<Component>(lookahead<Distance>, std::move(func)) : void()), ...);
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, prefetching data for the entities that come next.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * void(Component &...);
+     * @endcode
+     *
+     * The pool of the suggested component is used to lead the iterations. The
+     * returned entities will therefore respect the order of the pool associated
+     * with that type.
+     *
+     * @sa each
+     *
+     * @tparam Comp Type of component to use to enforce the iteration order.
+     * @tparam Distance Number of entities to look ahead.
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Comp, std::size_t Distance, typename Func>
+    void each(lookahead_t<Distance>, Func func) const {
+        static_assert(Distance != 0);
+        using other_type = type_list_cat_t<std::conditional_t<std::is_same_v<Comp, Component>, type_list<>, type_list<Component>>...>;
+        traverse<Comp>(std::move(func), lookahead<Distance>, other_type{}, type_list<Component...>{});
+    }
+
+    /**
+     * @brief Returns an execution plan for the view.
+     *
+     * A plan is a permutation of the indexes of the components and of the
+     * excluded components, where the index of the _n-th_ excluded component is
+     * `sizeof...(Component) + n`. The first element of a plan is always the
+     * component whose pool leads the iterations, that is the smallest one. The
+     * remaining elements define the order in which the other pools are probed
+     * for each candidate. Pools are sorted by their estimated selectivity, so
+     * that the ones that are more likely to reject a candidate are probed
+     * first.<br/>
+     * Selectivity is estimated from the sizes of the pools. Smaller pools of
+     * components and larger pools of excluded components come first.
+     *
+     * Plans can be cached and reused as long as the distribution of the
+     * components doesn't change much. A stale plan is never wrong, it's only
+     * less efficient than an up-to-date one.
+     *
+     * @return A plan to use to iterate the view.
+     */
+    plan_type plan() const {
+        const std::array<const sparse_set<Entity> *, std::tuple_size_v<plan_type>> all{std::get<pool_type<Component> *>(pools)..., std::get<pool_type<Exclude> *>(filter)...};
+        const auto universe = (*std::max_element(all.cbegin(), all.cend(), [](const auto *lhs, const auto *rhs) { return lhs->size() < rhs->size(); }))->size();
+        plan_type order{};
+
+        std::iota(order.begin(), order.end(), size_type{});
+
+        const auto lead = std::min_element(order.begin(), order.begin() + sizeof...(Component), [&all](const auto lhs, const auto rhs) {
+            return all[lhs]->size() < all[rhs]->size();
+        });
+
+        std::rotate(order.begin(), lead, lead + 1);
+
+        std::stable_sort(order.begin() + 1, order.end(), [&all, universe](const auto lhs, const auto rhs) {
+            const auto pass = [&all, universe](const auto pos) {
+                return pos < sizeof...(Component) ? all[pos]->size() : (universe - all[pos]->size());
+            };
+
+            return pass(lhs) < pass(rhs);
+        });
+
+        return order;
+    }
+
+    /**
+     * @brief Iterates entities and components according to an execution plan
+     * and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &...);
+     * void(Component &...);
+     * @endcode
+     *
+     * The pool of the component at the head of the plan leads the iterations,
+     * all the other pools are probed in the order imposed by the plan.
+     *
+     * @sa plan
+     *
+     * @warning
+     * Attempting to use a plan that isn't a valid permutation or that isn't led
+     * by a component results in undefined behavior.<br/>
+     * An assertion will abort the execution at runtime in debug mode in case
+     * the plan isn't led by a component.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param order A valid execution plan.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const plan_type &order, Func func) const {
+        ENTT_ASSERT(order[0] < sizeof...(Component));
+        const std::array<const sparse_set<Entity> *, std::tuple_size_v<plan_type>> all{std::get<pool_type<Component> *>(pools)..., std::get<pool_type<Exclude> *>(filter)...};
+        probe_type probes{};
+
+        for(size_type pos{1}; pos < order.size(); ++pos) {
+            probes[pos - 1] = { all[order[pos]], !(order[pos] < sizeof...(Component)) };
+        }
+
+        size_type pos{};
+        ((pos++ == order[0] ? traverse<Component>(std::move(func), probes, type_list<Component...>{}) : void()), ...);
+    }
+
+    /**
+     * @brief Combines in parallel the results of a transformation applied to
+     * all the entities and components.
+     *
+     * The transformation is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the transformation must be equivalent to one of the
+     * following forms:
+     *
+     * @code{.cpp}
+     * Ret(const entity_type, Component &...);
+     * Ret(Component &...);
+     * @endcode
+     *
+     * Entities are split in chunks of the given size. Chunks are processed by
+     * the given executor and each of them produces a partial result. The
+     * default executor runs them on the calling thread, a `parallel_for`
+     * spreads them over its workers. Partial results are then combined with
+     * the initial value one after the other, in the same order in which the
+     * chunks are iterated. Therefore, as long as the chunk size doesn't
+     * change, the result doesn't depend on the number of threads used and
+     * it's the same bit for bit from run to run.
+     *
+     * @warning
+     * Both the transformation and the reduction are likely invoked from
+     * multiple threads at the same time and must be safe to use this way.
+     *
+     * @tparam Type Type of the result.
+     * @tparam Reduce Type of the binary reduction function object.
+     * @tparam Transform Type of the transformation function object.
+     * @tparam Exec Type of the executor to use to process the chunks.
+     * @param init Initial value of the reduction.
+     * @param reduce A valid binary reduction function object.
+     * @param transform A valid transformation function object.
+     * @param chunk Number of entities per chunk.
+     * @param exec A valid executor (see `sequential_for` and `parallel_for`
+     * for more details).
+     * @return The result of the reduction.
+     */
+    template<typename Type, typename Reduce, typename Transform, typename Exec = sequential_for>
+    Type transform_reduce(Type init, Reduce reduce, Transform transform, const size_type chunk = 1024u, Exec exec = Exec{}) const {
+        const auto *view = candidate();
+        ((std::get<pool_type<Component> *>(pools) == view ? (init = chunked<Component>(std::move(init), reduce, transform, chunk, exec), void()) : void()), ...);
+        return init;
+    }
+
     /**
      * @brief Iterates entities and components and applies the given function
      * object to them.
@@ -737,6 +1232,211 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, if the component changed after a checkpoint.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a reference to its component. The _constness_ of the
+     * component is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &);
+     * void(Component &);
+     * @endcode
+     *
+     * The underlying pool must be a storage that keeps track of changes. Pages
+     * of components that didn't change are skipped at once.
+     *
+     * @sa basic_tick_storage
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param filter A filter created with `changed`.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const changed_t<std::remove_const_t<Component>> filter, Func func) const {
+        pool->each_changed(filter.since, [this, &func](const auto entt) {
+            if constexpr(std::is_invocable_v<Func, decltype(get({}))>) {
+                func(pool->get(entt));
+            } else {
+                func(entt, pool->get(entt));
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components and applies the given function
+     * object to them, if the component was assigned after a checkpoint.
+     *
+     * @sa each
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param filter A filter created with `added`.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(const added_t<std::remove_const_t<Component>> filter, Func func) const {
+        pool->each_added(filter.since, [this, &func](const auto entt) {
+            if constexpr(std::is_invocable_v<Func, decltype(get({}))>) {
+                func(pool->get(entt));
+            } else {
+                func(entt, pool->get(entt));
+            }
+        });
+    }
+
+    /**
+     * @brief Iterates entities and components for a limited number of entities
+     * and applies the given function object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a reference to its component. The _constness_ of the
+     * component is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Component &);
+     * void(Component &);
+     * @endcode
+     *
+     * At most `count` entities are visited, starting from the given cursor.
+     *
+     * @sa cursor
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param count Maximum number of entities to visit.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Func>
+    cursor each(const cursor from, const size_type count, Func func) const {
+        using difference_type = typename iterator_type::difference_type;
+        const auto last = (std::min)(from.next, pool->size());
+        const auto length = (std::min)(last, count);
+        const auto first = pool->end() - difference_type(last);
+
+        if constexpr(std::is_invocable_v<Func, decltype(get({}))>) {
+            std::for_each(first, first + difference_type(length), std::move(func));
+        } else {
+            std::for_each(end() - difference_type(last), end() - difference_type(last - length), [&func, raw = first](const auto entt) mutable {
+                func(entt, *(raw++));
+            });
+        }
+
+        return cursor{last - length, pool};
+    }
+
+    /**
+     * @brief Iterates entities and components until a deadline is reached and
+     * applies the given function object to them.
+     *
+     * The deadline is checked every `cursor::granularity` entities. Apart from
+     * this, this function works exactly as its counterpart that accepts a
+     * maximum number of entities.
+     *
+     * @sa cursor
+     *
+     * @tparam Clock Type of clock used to measure time.
+     * @tparam Duration Type of duration of the time point.
+     * @tparam Func Type of the function object to invoke.
+     * @param from A cursor to the point from which to resume the iteration.
+     * @param deadline Point in time after which the iteration is suspended.
+     * @param func A valid function object.
+     * @return A cursor to use to resume the iteration.
+     */
+    template<typename Clock, typename Duration, typename Func>
+    cursor each(cursor from, const std::chrono::time_point<Clock, Duration> deadline, Func func) const {
+        while(!from.done() && Clock::now() < deadline) {
+            from = each(from, cursor::granularity, std::ref(func));
+        }
+
+        return from;
+    }
+
+    /**
+     * @brief Combines in parallel the results of a transformation applied to
+     * all the entities and components.
+     *
+     * The transformation is invoked for each entity. It is provided with the
+     * entity itself and a set of references to all its components. The
+     * _constness_ of the components is as requested.<br/>
+     * The signature of the transformation must be equivalent to one of the
+     * following forms:
+     *
+     * @code{.cpp}
+     * Ret(const entity_type, Component &);
+     * Ret(Component &);
+     * @endcode
+     *
+     * Entities are split in chunks of the given size. Chunks are processed by
+     * the given executor and each of them produces a partial result. The
+     * default executor runs them on the calling thread, a `parallel_for`
+     * spreads them over its workers. Partial results are then combined with
+     * the initial value one after the other, in the same order in which the
+     * chunks are iterated. Therefore, as long as the chunk size doesn't
+     * change, the result doesn't depend on the number of threads used and
+     * it's the same bit for bit from run to run.
+     *
+     * @warning
+     * Both the transformation and the reduction are likely invoked from
+     * multiple threads at the same time and must be safe to use this way.
+     *
+     * @tparam Type Type of the result.
+     * @tparam Reduce Type of the binary reduction function object.
+     * @tparam Transform Type of the transformation function object.
+     * @tparam Exec Type of the executor to use to process the chunks.
+     * @param init Initial value of the reduction.
+     * @param reduce A valid binary reduction function object.
+     * @param transform A valid transformation function object.
+     * @param chunk Number of entities per chunk.
+     * @param exec A valid executor (see `sequential_for` and `parallel_for`
+     * for more details).
+     * @return The result of the reduction.
+     */
+    template<typename Type, typename Reduce, typename Transform, typename Exec = sequential_for>
+    Type transform_reduce(Type init, Reduce reduce, Transform transform, const size_type chunk = 1024u, Exec exec = Exec{}) const {
+        return internal::chunked_reduce(std::move(init), reduce, pool->size(), chunk, exec, [this, &transform](const auto first, const auto last, auto fold) {
+            using difference_type = typename iterator_type::difference_type;
+            auto raw = pool->begin() + difference_type(first);
+
+            for(auto it = begin() + difference_type(first), end = begin() + difference_type(last); it != end; ++it, ++raw) {
+                if constexpr(std::is_invocable_v<Transform, decltype(get({}))>) {
+                    fold(transform(*raw));
+                } else {
+                    fold(transform(*it, *raw));
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Combines in parallel all the components.
+     *
+     * This function works exactly as `transform_reduce`, but for the fact that
+     * the components are combined as they are.
+     *
+     * @sa transform_reduce
+     *
+     * @tparam Type Type of the result.
+     * @tparam Reduce Type of the binary reduction function object.
+     * @tparam Exec Type of the executor to use to process the chunks.
+     * @param init Initial value of the reduction.
+     * @param reduce A valid binary reduction function object.
+     * @param chunk Number of entities per chunk.
+     * @param exec A valid executor (see `sequential_for` and `parallel_for`
+     * for more details).
+     * @return The result of the reduction.
+     */
+    template<typename Type, typename Reduce, typename Exec = sequential_for>
+    Type reduce(Type init, Reduce reduce, const size_type chunk = 1024u, Exec exec = Exec{}) const {
+        return transform_reduce(std::move(init), std::move(reduce), [](const Component &component) -> const Component & { return component; }, chunk, std::move(exec));
+    }
+
     /**
      * @brief Iterates entities and components and applies the given function
      * object to them.
@@ -9,6 +9,7 @@
 #include "entity/entity.hpp"
 #include "entity/group.hpp"
 #include "entity/helper.hpp"
+#include "entity/index.hpp"
 #include "entity/observer.hpp"
 #include "entity/registry.hpp"
 #include "entity/runtime_view.hpp"
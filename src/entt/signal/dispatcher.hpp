@@ -46,28 +46,73 @@ class dispatcher {
     struct signal_wrapper: base_wrapper {
         using signal_type = sigh<void(const Event &)>;
         using sink_type = typename signal_type::sink_type;
+        using batch_signal_type = sigh<void(const Event *, std::size_t)>;
+        using batch_sink_type = typename batch_signal_type::sink_type;
 
-        void publish() override {
-            const auto length = events.size();
+        // lanes are filled by different threads, keep them on separate cache lines
+        struct alignas(64) lane_type {
+            std::vector<Event> events;
+        };
+
+        void deliver(std::vector<Event> &queue) {
+            // events enqueued by the listeners land in the empty buffer swapped in
+            queue.swap(buffer);
+
+            if(!signal.empty()) {
+                for(auto &&event: std::as_const(buffer)) {
+                    signal.publish(event);
+                }
+            }
 
-            for(std::size_t pos{}; pos < length; ++pos) {
-                signal.publish(events[pos]);
+            if(!buffer.empty()) {
+                batch.publish(buffer.data(), buffer.size());
             }
 
-            events.erase(events.cbegin(), events.cbegin()+length);
+            buffer.clear();
+        }
+
+        void publish() override {
+            deliver(events);
+
+            for(auto &&lane: lanes) {
+                deliver(lane.events);
+            }
         }
 
         void clear() ENTT_NOEXCEPT override {
+            for(auto &&lane: lanes) {
+                lane.events.clear();
+            }
+
             events.clear();
         }
 
+        void reserve(const std::size_t count) {
+            lanes.resize(count);
+        }
+
+        template<typename... Args>
+        void enqueue_at(const std::size_t lane, Args &&... args) {
+            ENTT_ASSERT(lane < lanes.size());
+            lanes[lane].events.emplace_back(std::forward<Args>(args)...);
+        }
+
         sink_type sink() ENTT_NOEXCEPT {
             return entt::sink{signal};
         }
 
+        batch_sink_type batch_sink() ENTT_NOEXCEPT {
+            return entt::sink{batch};
+        }
+
+        void notify(const Event &event) {
+            signal.publish(event);
+            batch.publish(&event, 1u);
+        }
+
         template<typename... Args>
         void trigger(Args &&... args) {
-            signal.publish({ std::forward<Args>(args)... });
+            notify({ std::forward<Args>(args)... });
         }
 
         template<typename... Args>
@@ -77,7 +122,10 @@ class dispatcher {
 
     private:
         signal_type signal{};
+        batch_signal_type batch{};
         std::vector<Event> events;
+        std::vector<Event> buffer;
+        std::vector<lane_type> lanes;
     };
 
     struct wrapper_data {
@@ -125,6 +173,53 @@ class dispatcher {
     }
 
 public:
+    /**
+     * @brief Lanes used to enqueue events of a given type from multiple
+     * threads.
+     *
+     * @sa dispatcher::lanes
+     *
+     * @tparam Event Type of events to enqueue.
+     */
+    template<typename Event>
+    class lane_set {
+        /*! @brief A dispatcher is allowed to create lanes. */
+        friend class dispatcher;
+
+        lane_set(signal_wrapper<Event> &ref) ENTT_NOEXCEPT
+            : wrapper{&ref}
+        {}
+
+    public:
+        /**
+         * @brief Enqueues an event in a lane.
+         *
+         * An event of the given type is queued. No listener is invoked. Use the
+         * `update` member function of the dispatcher to notify listeners when
+         * ready.<br/>
+         * This function can be invoked concurrently from multiple threads,
+         * provided that each of them uses its own lane and that events of the
+         * same type aren't delivered nor discarded in the meantime.
+         *
+         * @warning
+         * Attempting to use a lane that doesn't exist results in undefined
+         * behavior.<br/>
+         * An assertion will abort the execution at runtime in debug mode in
+         * case the lane doesn't exist.
+         *
+         * @tparam Args Types of arguments to use to construct the event.
+         * @param lane A valid lane index.
+         * @param args Arguments to use to construct the event.
+         */
+        template<typename... Args>
+        void enqueue(const std::size_t lane, Args &&... args) const {
+            wrapper->enqueue_at(lane, std::forward<Args>(args)...);
+        }
+
+    private:
+        signal_wrapper<Event> *wrapper;
+    };
+
     /*! @brief Type of sink for the given event. */
     template<typename Event>
     using sink_type = typename signal_wrapper<Event>::sink_type;
@@ -151,6 +246,36 @@ public:
         return assure<Event>().sink();
     }
 
+    /*! @brief Type of batch sink for the given event. */
+    template<typename Event>
+    using batch_sink_type = typename signal_wrapper<Event>::batch_sink_type;
+
+    /**
+     * @brief Returns a batch sink object for the given event.
+     *
+     * Listeners connected to a batch sink receive queued events in bulk rather
+     * than one at a time. They are invoked once for each non-empty queue when
+     * events are delivered, that is once per update unless lanes are in use,
+     * after all the listeners of the sink for the same type of event. Immediate
+     * events are sent to them one at a time instead.
+     *
+     * The function type for a listener is:
+     * @code{.cpp}
+     * void(const Event *, std::size_t);
+     * @endcode
+     *
+     * The order of invocation of the listeners isn't guaranteed.
+     *
+     * @sa sink
+     *
+     * @tparam Event Type of event of which to get the batch sink.
+     * @return A temporary sink object.
+     */
+    template<typename Event>
+    batch_sink_type<Event> batch_sink() ENTT_NOEXCEPT {
+        return assure<Event>().batch_sink();
+    }
+
     /**
      * @brief Triggers an immediate event of the given type.
      *
@@ -209,11 +334,45 @@ public:
         assure<std::decay_t<Event>>().enqueue(std::forward<Event>(event));
     }
 
+    /**
+     * @brief Prepares the lanes used to enqueue events of the given type from
+     * multiple threads.
+     *
+     * Each lane is a separate queue meant to be filled by a single producer at
+     * a time. Producers don't share any state, therefore they can enqueue
+     * events concurrently without locks as long as they use different lanes.
+     * When events are delivered, those in the main queue come first, then the
+     * ones in the lanes in order. The result doesn't depend on how producers
+     * are scheduled, as long as they are assigned lanes deterministically (as
+     * an example, a lane per job of a `parallel_for`).
+     *
+     * The queues are resolved once and for all by this function. Producers
+     * enqueue events through the returned object and never touch the
+     * dispatcher, that can be used meanwhile for other types of events.
+     *
+     * @sa lane_set
+     *
+     * @warning
+     * This function isn't thread safe and must be invoked on the thread that
+     * owns the dispatcher before any producer starts. Reducing the number of
+     * lanes discards the events still queued in the ones removed.
+     *
+     * @tparam Event Type of events to prepare the lanes for.
+     * @param count Number of lanes to make available.
+     * @return An object to use to enqueue events in the lanes.
+     */
+    template<typename Event>
+    lane_set<Event> lanes(const std::size_t count) {
+        auto &wrapper = assure<Event>();
+        wrapper.reserve(count);
+        return lane_set<Event>{wrapper};
+    }
+
     /**
      * @brief Discards all the events queued so far.
      *
      * If no types are provided, the dispatcher will clear all the existing
-     * pools.
+     * pools. Queues retain their capacity.
      *
      * @tparam Event Type of events to discard.
      */
@@ -237,6 +396,10 @@ public:
      * delivered to the registered listeners. It's responsibility of the users
      * to reduce at a minimum the time spent in the bodies of the listeners.
      *
+     * Queues are double buffered: pending events are swapped out before being
+     * delivered, so that those enqueued by the listeners in the meantime are
+     * kept aside for the next update without moving anything around.
+     *
      * @tparam Event Type of events to send.
      */
     template<typename Event>
@@ -17,6 +17,10 @@ class sink;
 template<typename>
 class sigh;
 
+/*! @class slot_sigh */
+template<typename>
+class slot_sigh;
+
 
 }
 
@@ -2,6 +2,7 @@
 #define ENTT_SIGNAL_SIGH_HPP
 
 
+#include <limits>
 #include <vector>
 #include <utility>
 #include <iterator>
@@ -574,6 +575,208 @@ template<typename Ret, typename... Args>
 sink(sigh<Ret(Args...)> &) ENTT_NOEXCEPT -> sink<Ret(Args...)>;
 
 
+/**
+ * @brief Slot-map based signal handler.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ *
+ * @tparam Function A valid function type.
+ */
+template<typename Function>
+class slot_sigh;
+
+
+/**
+ * @brief Slot-map based signal handler.
+ *
+ * It works like an unmanaged signal handler, but for the fact that listeners
+ * are connected and disconnected by means of handles in constant time.<br/>
+ * Listeners are kept in a tightly packed array, therefore publishing a signal
+ * is still a linear walk. Handles refer to slots that are recycled once
+ * disconnected and each slot has a version that is incremented on release, so
+ * that stale handles are detected and ignored.
+ *
+ * Unlike unmanaged signal handlers, a listener can be connected more than once
+ * and each connection has its own handle. Order of listeners isn't guaranteed
+ * and changes when a listener is disconnected.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ */
+template<typename Ret, typename... Args>
+class slot_sigh<Ret(Args...)> {
+    static constexpr auto null = (std::numeric_limits<std::size_t>::max)();
+
+    struct slot_type {
+        // position in the packed array if in use, next free slot otherwise
+        std::size_t index;
+        std::size_t version;
+    };
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Handle to a connected listener. */
+    struct handle_type {
+        /*! @brief Slot to which the listener is assigned. */
+        size_type index{};
+        /*! @brief Version of the slot when the listener was connected. */
+        size_type version{};
+    };
+
+    /**
+     * @brief Number of listeners connected to the signal.
+     * @return Number of listeners currently connected.
+     */
+    size_type size() const ENTT_NOEXCEPT {
+        return calls.size();
+    }
+
+    /**
+     * @brief Returns false if at least a listener is connected to the signal.
+     * @return True if the signal has no listeners connected, false otherwise.
+     */
+    bool empty() const ENTT_NOEXCEPT {
+        return calls.empty();
+    }
+
+    /**
+     * @brief Checks if a handle refers to a listener that is still connected.
+     * @param handle A handle returned by the signal.
+     * @return True if the listener is still connected, false otherwise.
+     */
+    bool contains(const handle_type handle) const ENTT_NOEXCEPT {
+        return handle.index < slots.size() && slots[handle.index].version == handle.version;
+    }
+
+    /**
+     * @brief Connects a delegate to a signal.
+     * @param call A valid delegate.
+     * @return A handle to use to disconnect the listener.
+     */
+    handle_type connect(delegate<Ret(Args...)> call) {
+        ENTT_ASSERT(call);
+        auto pos = available;
+
+        if(pos == null) {
+            pos = slots.size();
+            slots.push_back({calls.size(), 1u});
+        } else {
+            available = slots[pos].index;
+            slots[pos].index = calls.size();
+        }
+
+        calls.push_back(std::move(call));
+        owners.push_back(pos);
+
+        return { pos, slots[pos].version };
+    }
+
+    /**
+     * @brief Connects a free function, an unbound or a bound member to a
+     * signal.
+     *
+     * @sa delegate::connect
+     *
+     * @tparam Candidate Function or member to connect to the signal.
+     * @tparam Type Type of class or type of payload, if any.
+     * @param value_or_instance A valid object that fits the purpose, if any.
+     * @return A handle to use to disconnect the listener.
+     */
+    template<auto Candidate, typename... Type>
+    handle_type connect(Type &&... value_or_instance) {
+        delegate<Ret(Args...)> call{};
+        call.template connect<Candidate>(std::forward<Type>(value_or_instance)...);
+        return connect(std::move(call));
+    }
+
+    /**
+     * @brief Disconnects a listener from a signal.
+     *
+     * Stale handles are ignored.
+     *
+     * @param handle A handle returned by the signal.
+     */
+    void disconnect(const handle_type handle) {
+        if(contains(handle)) {
+            auto &slot = slots[handle.index];
+            const auto pos = slot.index;
+
+            calls[pos] = std::move(calls.back());
+            owners[pos] = owners.back();
+            slots[owners[pos]].index = pos;
+            calls.pop_back();
+            owners.pop_back();
+
+            slot.index = std::exchange(available, handle.index);
+            ++slot.version;
+        }
+    }
+
+    /*! @brief Disconnects all the listeners from a signal. */
+    void disconnect() {
+        for(const auto pos: owners) {
+            slots[pos].index = std::exchange(available, pos);
+            ++slots[pos].version;
+        }
+
+        calls.clear();
+        owners.clear();
+    }
+
+    /**
+     * @brief Triggers a signal.
+     *
+     * All the listeners are notified. Order isn't guaranteed.
+     *
+     * @param args Arguments to use to invoke listeners.
+     */
+    void publish(Args... args) const {
+        std::for_each(calls.cbegin(), calls.cend(), [&args...](auto &&call) {
+            call(args...);
+        });
+    }
+
+    /**
+     * @brief Collects return values from the listeners.
+     *
+     * @sa sigh::collect
+     *
+     * @tparam Func Type of collector to use, if any.
+     * @param func A valid function object.
+     * @param args Arguments to use to invoke listeners.
+     */
+    template<typename Func>
+    void collect(Func func, Args... args) const {
+        for(auto &&call: calls) {
+            if constexpr(std::is_void_v<Ret>) {
+                if constexpr(std::is_invocable_r_v<bool, Func>) {
+                    call(args...);
+                    if(func()) { break; }
+                } else {
+                    call(args...);
+                    func();
+                }
+            } else {
+                if constexpr(std::is_invocable_r_v<bool, Func, Ret>) {
+                    if(func(call(args...))) { break; }
+                } else {
+                    func(call(args...));
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<delegate<Ret(Args...)>> calls{};
+    std::vector<size_type> owners{};
+    std::vector<slot_type> slots{};
+    size_type available{null};
+};
+
+
 }
 
 
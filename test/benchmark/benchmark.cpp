@@ -3,8 +3,20 @@
 #include <cstdint>
 #include <chrono>
 #include <iterator>
+#include <random>
+#include <vector>
+#include <unordered_map>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <mutex>
 #include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
+#include <entt/entity/index.hpp>
+#include <entt/entity/observer.hpp>
 #include <entt/entity/registry.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/sigh.hpp>
 
 struct position {
     std::uint64_t x;
@@ -16,6 +28,92 @@ struct velocity {
     std::uint64_t y;
 };
 
+struct location {
+    float x;
+    float y;
+};
+
+struct state {
+    std::uint64_t data[25];
+};
+
+struct drawable {
+    std::uint32_t depth;
+    std::uint32_t material;
+    std::uint64_t mesh;
+};
+
+struct large {
+    std::uint64_t data[32];
+};
+
+struct large_indirect {
+    std::uint64_t data[32];
+};
+
+template<>
+struct entt::storage<entt::entity, large_indirect>: entt::basic_indirect_storage<entt::entity, large_indirect> {};
+
+struct health {
+    std::uint64_t value;
+};
+
+template<>
+struct entt::storage<entt::entity, health>: entt::basic_tick_storage<entt::entity, health> {};
+
+struct ticket {
+    std::uint64_t value;
+};
+
+struct stable_ticket {
+    std::uint64_t value;
+};
+
+template<>
+struct entt::storage<entt::entity, stable_ticket>: entt::basic_stable_storage<entt::entity, stable_ticket> {};
+
+struct config {
+    std::uint64_t data[32];
+};
+
+struct shared_config {
+    std::uint64_t data[32];
+
+    bool operator==(const shared_config &other) const {
+        return std::equal(std::begin(data), std::end(data), std::begin(other.data));
+    }
+};
+
+template<>
+struct std::hash<shared_config> {
+    std::size_t operator()(const shared_config &instance) const {
+        return std::hash<std::uint64_t>{}(instance.data[0]);
+    }
+};
+
+template<>
+struct entt::storage<entt::entity, shared_config>: entt::basic_shared_storage<entt::entity, shared_config> {};
+
+struct transform {
+    float data[16];
+};
+
+struct buffered_transform {
+    float data[16];
+};
+
+template<>
+struct entt::storage<entt::entity, buffered_transform>: entt::basic_buffered_storage<entt::entity, buffered_transform> {};
+
+template<std::size_t>
+struct tag {};
+
+template<std::size_t>
+struct bitset_tag {};
+
+template<std::size_t N>
+struct entt::storage<entt::entity, bitset_tag<N>>: entt::basic_bitset_indexed_storage<entt::entity, bitset_tag<N>> {};
+
 template<std::size_t>
 struct comp { int x; };
 
@@ -135,6 +233,40 @@ TEST(Benchmark, Destroy) {
     timer.elapsed();
 }
 
+TEST(Benchmark, Replace1M) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+
+    std::cout << "Replacing 1000000 components of 200 bytes" << std::endl;
+
+    registry.create<state>(entities.begin(), entities.end());
+    timer timer;
+
+    for(const auto entity: entities) {
+        auto curr = registry.get<state>(entity);
+        curr.data[0] += 1u;
+        registry.replace<state>(entity, curr);
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, Patch1M) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+
+    std::cout << "Patching 1000000 components of 200 bytes" << std::endl;
+
+    registry.create<state>(entities.begin(), entities.end());
+    timer timer;
+
+    registry.patch<state>(entities.begin(), entities.end(), [](auto &curr) {
+        curr.data[0] += 1u;
+    });
+
+    timer.elapsed();
+}
+
 TEST(Benchmark, IterateSingleComponent1M) {
     entt::registry registry;
 
@@ -937,149 +1069,1241 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
     });
 }
 
-TEST(Benchmark, IteratePathological) {
-    std::cout << "Pathological case" << std::endl;
+template<typename Func>
+void skewed(Func func) {
+    entt::registry registry;
 
-    pathological([](auto &registry, auto func) {
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity);
+
+        if(i % 10) {
+            registry.assign<velocity>(entity);
+        }
+
+        if(i % 20) {
+            registry.assign<comp<0>>(entity);
+        }
+
+        if(i % 100) {
+            registry.assign<comp<1>>(entity);
+        }
+    }
+
+    func(registry, [](auto &... comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsSkewedExclude1M) {
+    std::cout << "Iterating over 1000000 entities, three components, one excluded component on 99% of the entities" << std::endl;
+
+    skewed([](auto &registry, auto func) {
         timer timer;
-        registry.template view<position, velocity, comp<0>>().each(func);
+        registry.template view<position, velocity, comp<0>>(entt::exclude<comp<1>>).each(func);
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, IteratePathologicalNonOwningGroup) {
-    std::cout << "Pathological case (non-owning group)" << std::endl;
+TEST(Benchmark, IterateThreeComponentsSkewedExcludePlanned1M) {
+    std::cout << "Iterating over 1000000 entities, three components, one excluded component on 99% of the entities, planned" << std::endl;
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<>(entt::get<position, velocity, comp<0>>);
+    skewed([](auto &registry, auto func) {
+        auto view = registry.template view<position, velocity, comp<0>>(entt::exclude<comp<1>>);
 
         timer timer;
-        group.each(func);
+        view.each(view.plan(), func);
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, IteratePathologicalFullOwningGroup) {
-    std::cout << "Pathological case (full-owning group)" << std::endl;
+template<typename Func>
+void scattered(Func func) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000L);
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<position, velocity, comp<0>>();
+    registry.create(entities.begin(), entities.end());
+
+    // scatters the pools with respect to each other
+    std::mt19937 generator{42u};
+    std::shuffle(entities.begin(), entities.end(), generator);
+    registry.assign<position>(entities.begin(), entities.end());
+    std::shuffle(entities.begin(), entities.end(), generator);
+    registry.assign<velocity>(entities.begin(), entities.end());
+    std::shuffle(entities.begin(), entities.end(), generator);
+    registry.assign<comp<0>>(entities.begin(), entities.end());
+    std::shuffle(entities.begin(), entities.end(), generator);
+    registry.assign<comp<1>>(entities.begin(), entities.end());
+    std::shuffle(entities.begin(), entities.end(), generator);
+    registry.assign<comp<2>>(entities.begin(), entities.end());
+
+    func(registry, [](auto &... comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
+TEST(Benchmark, IterateThreeComponentsScattered1M) {
+    std::cout << "Iterating over 1000000 entities, three components, scattered pools" << std::endl;
 
+    scattered([](auto &registry, auto func) {
         timer timer;
-        group.each(func);
+        registry.template view<position, velocity, comp<0>>().template each<position>(func);
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
-    std::cout << "Pathological case (partial-owning group)" << std::endl;
+TEST(Benchmark, IterateThreeComponentsScatteredLookahead1M) {
+    std::cout << "Iterating over 1000000 entities, three components, scattered pools, lookahead" << std::endl;
 
-    pathological([](auto &registry, auto func) {
-        auto group = registry.template group<position, velocity>(entt::get<comp<0>>);
+    scattered([](auto &registry, auto func) {
+        timer timer;
+        registry.template view<position, velocity, comp<0>>().template each<position>(entt::lookahead<8>, func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, IterateFiveComponentsScattered1M) {
+    std::cout << "Iterating over 1000000 entities, five components, scattered pools" << std::endl;
 
+    scattered([](auto &registry, auto func) {
         timer timer;
-        group.each(func);
+        registry.template view<position, velocity, comp<0>, comp<1>, comp<2>>().template each<position>(func);
         timer.elapsed();
     });
 }
 
-TEST(Benchmark, SortSingle) {
+TEST(Benchmark, IterateFiveComponentsScatteredLookahead1M) {
+    std::cout << "Iterating over 1000000 entities, five components, scattered pools, lookahead" << std::endl;
+
+    scattered([](auto &registry, auto func) {
+        timer timer;
+        registry.template view<position, velocity, comp<0>, comp<1>, comp<2>>().template each<position>(entt::lookahead<8>, func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, ReduceTwoComponents1M) {
     entt::registry registry;
 
-    std::cout << "Sort 150000 entities, one component" << std::endl;
+    std::cout << "Reducing over 1000000 entities, two components" << std::endl;
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
         registry.assign<position>(entity, i, i);
+        registry.assign<velocity>(entity, i, i);
     }
 
     timer timer;
+    std::uint64_t sum{};
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x < rhs.x && lhs.y < rhs.y;
+    registry.view<position, velocity>().each([&sum](const auto &pos, const auto &vel) {
+        sum += pos.x * vel.y;
     });
 
     timer.elapsed();
+    ASSERT_NE(sum, 0u);
 }
 
-TEST(Benchmark, SortMulti) {
+TEST(Benchmark, ReduceTwoComponentsParallel1M) {
     entt::registry registry;
 
-    std::cout << "Sort 150000 entities, two components" << std::endl;
+    std::cout << "Reducing over 1000000 entities, two components, parallel" << std::endl;
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
         const auto entity = registry.create();
         registry.assign<position>(entity, i, i);
         registry.assign<velocity>(entity, i, i);
     }
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x < rhs.x && lhs.y < rhs.y;
-    });
-
+    entt::parallel_for executor{};
     timer timer;
 
-    registry.sort<velocity, position>();
+    const auto sum = registry.view<position, velocity>().transform_reduce(std::uint64_t{}, std::plus<>{}, [](const auto &pos, const auto &vel) {
+        return pos.x * vel.y;
+    }, 16384u, executor);
 
     timer.elapsed();
+    ASSERT_NE(sum, 0u);
 }
 
-TEST(Benchmark, AlmostSortedStdSort) {
+template<typename Func>
+void lookup(Func func) {
     entt::registry registry;
-    entt::entity entities[3];
+    std::vector<entt::entity> entities(1000000u);
+    std::vector<std::uint64_t> keys(1000u);
+    std::mt19937 gen{42};
 
-    std::cout << "Sort 150000 entities, almost sorted, std::sort" << std::endl;
+    registry.create(entities.begin(), entities.end());
+    std::generate(keys.begin(), keys.end(), [&gen, &entities]() { return std::uniform_int_distribution<std::uint64_t>{0u, entities.size() - 1u}(gen); });
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.assign<position>(entity, i, i);
+    func(registry, [&registry, &entities]() {
+        for(std::uint64_t i = 0; i < entities.size(); i++) {
+            registry.assign<position>(entities[i], i, i);
+        }
+    }, keys);
+}
 
-        if(!(i % 50000)) {
-            entities[i / 50000] = entity;
+TEST(Benchmark, LookupByKeyViewScan) {
+    std::cout << "Looking up 1000 keys over 1000000 entities, view scan" << std::endl;
+
+    lookup([](auto &registry, auto populate, const auto &keys) {
+        populate();
+
+        timer timer;
+
+        for(auto key: keys) {
+            auto view = registry.template view<position>();
+            const auto it = std::find_if(view.begin(), view.end(), [&view, key](const auto entity) { return view.get(entity).x == key; });
+            ASSERT_NE(it, view.end());
         }
-    }
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entities[i]);
-        const auto entity = registry.create();
-        registry.assign<position>(entity, 50000 * i, 50000 * i);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, LookupByKeyUnorderedMap) {
+    std::cout << "Looking up 1000 keys over 1000000 entities, listeners and std::unordered_map" << std::endl;
+
+    lookup([](auto &registry, auto populate, const auto &keys) {
+        struct listener {
+            void on_construct(entt::entity entity, entt::registry &, const position &pos) { map.emplace(pos.x, entity); }
+            void on_destroy(entt::entity entity, entt::registry &reg) { map.erase(reg.get<position>(entity).x); }
+            std::unordered_map<std::uint64_t, entt::entity> map;
+        } handler{};
+
+        registry.template on_construct<position>().template connect<&listener::on_construct>(handler);
+        registry.template on_destroy<position>().template connect<&listener::on_destroy>(handler);
+
+        populate();
+
+        timer timer;
+
+        for(auto key: keys) {
+            ASSERT_NE(handler.map.find(key), handler.map.cend());
+        }
+
+        timer.elapsed();
+        registry.template on_construct<position>().disconnect(handler);
+        registry.template on_destroy<position>().disconnect(handler);
+    });
+}
+
+TEST(Benchmark, LookupByKeyHashIndex) {
+    std::cout << "Looking up 1000 keys over 1000000 entities, hash index" << std::endl;
+
+    lookup([](auto &registry, auto populate, const auto &keys) {
+        auto &index = registry.template index<&position::x>();
+
+        populate();
+
+        timer timer;
+
+        for(auto key: keys) {
+            ASSERT_FALSE(index.find(key) == entt::null);
+        }
+
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, RangeQueryViewScan) {
+    std::cout << "Range query over 1000000 entities, view scan" << std::endl;
+
+    lookup([](auto &registry, auto populate, const auto &) {
+        populate();
+
+        timer timer;
+        std::uint64_t count{};
+
+        registry.template view<position>().each([&count](const auto &pos) {
+            count += (pos.x < 1000u);
+        });
+
+        timer.elapsed();
+        ASSERT_EQ(count, 1000u);
+    });
+}
+
+TEST(Benchmark, RangeQueryOrderedIndex) {
+    std::cout << "Range query over 1000000 entities, ordered index" << std::endl;
+
+    lookup([](auto &registry, auto populate, const auto &) {
+        auto &index = registry.template index<entt::ordered_index<&position::x>>();
+
+        populate();
+
+        timer timer;
+        std::uint64_t count{};
+
+        index.each(index.begin(), index.lower_bound(1000u), [&count](const auto &) {
+            ++count;
+        });
+
+        timer.elapsed();
+        ASSERT_EQ(count, 1000u);
+    });
+}
+
+void proximity(entt::registry &registry) {
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<float> dist{0.f, 1000.f};
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        registry.assign<location>(registry.create(), dist(gen), dist(gen));
     }
+}
+
+TEST(Benchmark, ProximityQueryViewScan) {
+    entt::registry registry;
+
+    std::cout << "Proximity queries over 1000000 entities, view scan" << std::endl;
+
+    proximity(registry);
 
     timer timer;
+    std::uint64_t count{};
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x > rhs.x && lhs.y > rhs.y;
-    });
+    for(auto i = 0; i < 100; ++i) {
+        const auto center = 10.f * i;
+
+        registry.view<location>().each([&count, center](const auto &loc) {
+            count += ((loc.x - center) * (loc.x - center) + (loc.y - center) * (loc.y - center) <= 25.f);
+        });
+    }
 
     timer.elapsed();
+    ASSERT_NE(count, 0u);
 }
 
-TEST(Benchmark, AlmostSortedInsertionSort) {
+TEST(Benchmark, ProximityQueryGridIndex) {
     entt::registry registry;
-    entt::entity entities[3];
+    const auto &index = registry.index<entt::grid_index<&location::x, &location::y>>(5.f);
 
-    std::cout << "Sort 150000 entities, almost sorted, insertion sort" << std::endl;
+    std::cout << "Proximity queries over 1000000 entities, grid index" << std::endl;
 
-    for(std::uint64_t i = 0; i < 150000L; i++) {
-        const auto entity = registry.create();
-        registry.assign<position>(entity, i, i);
+    proximity(registry);
 
-        if(!(i % 50000)) {
-            entities[i / 50000] = entity;
-        }
+    timer timer;
+    std::uint64_t count{};
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto center = 10.f * i;
+        index.each({center, center}, 5.f, [&count](const auto) { ++count; });
     }
 
-    for(std::uint64_t i = 0; i < 3; ++i) {
-        registry.destroy(entities[i]);
-        const auto entity = registry.create();
-        registry.assign<position>(entity, 50000 * i, 50000 * i);
+    timer.elapsed();
+    ASSERT_NE(count, 0u);
+}
+
+void changes(entt::registry &registry) {
+    std::mt19937 gen{42u};
+    std::uniform_int_distribution<std::size_t> dist{0u, 999999u};
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        registry.assign<health>(registry.create(), i);
+    }
+
+    registry.pool<health>().checkpoint();
+
+    for(auto i = 0; i < 1000; ++i) {
+        registry.get<health>(registry.data<health>()[dist(gen)]).value = {};
     }
+}
+
+TEST(Benchmark, IterateChangedFullScan1M) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, changed since last checkpoint, full scan" << std::endl;
 
+    changes(registry);
+
+    const auto &cpool = registry.pool<health>();
+    std::uint64_t count{};
     timer timer;
 
-    registry.sort<position>([](const auto &lhs, const auto &rhs) {
-        return lhs.x > rhs.x && lhs.y > rhs.y;
-    }, entt::insertion_sort{});
+    registry.view<const health>().each([&cpool, &count](const auto entity, const auto &) {
+        count += (cpool.changed(entity) > 0u);
+    });
 
     timer.elapsed();
+    ASSERT_NE(count, 0u);
+}
+
+TEST(Benchmark, IterateChanged1M) {
+    entt::registry registry;
+
+    std::cout << "Iterating over 1000000 entities, changed since last checkpoint" << std::endl;
+
+    changes(registry);
+
+    std::uint64_t count{};
+    timer timer;
+
+    registry.view<const health>().each(entt::changed<health>(0u), [&count](const auto &) {
+        ++count;
+    });
+
+    timer.elapsed();
+    ASSERT_NE(count, 0u);
+}
+
+TEST(Benchmark, IteratePathological) {
+    std::cout << "Pathological case" << std::endl;
+
+    pathological([](auto &registry, auto func) {
+        timer timer;
+        registry.template view<position, velocity, comp<0>>().each(func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, IteratePathologicalNonOwningGroup) {
+    std::cout << "Pathological case (non-owning group)" << std::endl;
+
+    pathological([](auto &registry, auto func) {
+        auto group = registry.template group<>(entt::get<position, velocity, comp<0>>);
+
+        timer timer;
+        group.each(func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, IteratePathologicalFullOwningGroup) {
+    std::cout << "Pathological case (full-owning group)" << std::endl;
+
+    pathological([](auto &registry, auto func) {
+        auto group = registry.template group<position, velocity, comp<0>>();
+
+        timer timer;
+        group.each(func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
+    std::cout << "Pathological case (partial-owning group)" << std::endl;
+
+    pathological([](auto &registry, auto func) {
+        auto group = registry.template group<position, velocity>(entt::get<comp<0>>);
+
+        timer timer;
+        group.each(func);
+        timer.elapsed();
+    });
+}
+
+TEST(Benchmark, SortSingle) {
+    entt::registry registry;
+
+    std::cout << "Sort 150000 entities, one component" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, i, i);
+    }
+
+    timer timer;
+
+    registry.sort<position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x < rhs.x && lhs.y < rhs.y;
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortMulti) {
+    entt::registry registry;
+
+    std::cout << "Sort 150000 entities, two components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, i, i);
+        registry.assign<velocity>(entity, i, i);
+    }
+
+    registry.sort<position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x < rhs.x && lhs.y < rhs.y;
+    });
+
+    timer timer;
+
+    registry.sort<velocity, position>();
+
+    timer.elapsed();
+}
+
+void chain(entt::registry &registry) {
+    std::mt19937 gen{42u};
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, gen(), i);
+        registry.assign<comp<0>>(entity);
+        registry.assign<comp<1>>(entity);
+        registry.assign<comp<2>>(entity);
+        registry.assign<comp<3>>(entity);
+    }
+
+    registry.sort<position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x < rhs.x;
+    });
+}
+
+TEST(Benchmark, SortChain) {
+    entt::registry registry;
+
+    std::cout << "Sort 1000000 entities, four components after another one" << std::endl;
+
+    chain(registry);
+    timer timer;
+
+    registry.sort<comp<0>, position>();
+    registry.sort<comp<1>, position>();
+    registry.sort<comp<2>, position>();
+    registry.sort<comp<3>, position>();
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortChainRespect) {
+    entt::registry registry;
+
+    std::cout << "Respect 1000000 entities, four components after another one" << std::endl;
+
+    chain(registry);
+    timer timer;
+
+    registry.respect<comp<0>, comp<1>, comp<2>, comp<3>, position>();
+
+    timer.elapsed();
+}
+
+template<typename Type>
+void sort_large() {
+    entt::registry registry;
+    std::mt19937 gen{42u};
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        registry.assign<Type>(registry.create(), Type{{gen()}});
+    }
+
+    timer timer;
+
+    registry.sort<Type>([](const auto &lhs, const auto &rhs) {
+        return lhs.data[0] < rhs.data[0];
+    });
+
+    timer.elapsed();
+}
+
+template<typename Type>
+void churn_large() {
+    entt::registry registry;
+    std::vector<entt::entity> entities(150000);
+    registry.group<Type>(entt::get<int>);
+
+    registry.create<Type>(entities.begin(), entities.end());
+    timer timer;
+
+    for(auto i = 0; i < 10; ++i) {
+        for(auto pos = std::size_t(i % 2); pos < entities.size(); pos += 2u) {
+            registry.assign<int>(entities[pos]);
+        }
+
+        for(auto pos = std::size_t(i % 2); pos < entities.size(); pos += 2u) {
+            registry.remove<int>(entities[pos]);
+        }
+    }
+
+    timer.elapsed();
+}
+
+template<typename Type>
+void assign_and_iterate_configs() {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    std::uint64_t sum{};
+
+    registry.create(entities.begin(), entities.end());
+    timer timer;
+
+    for(std::size_t pos{}; pos < entities.size(); ++pos) {
+        registry.assign<Type>(entities[pos], Type{{pos % 16u}});
+    }
+
+    for(auto i = 0; i < 10; ++i) {
+        registry.view<const Type>().each([&sum](const auto &instance) {
+            sum += instance.data[0];
+        });
+    }
+
+    timer.elapsed();
+    ASSERT_NE(sum, 0u);
+}
+
+TEST(Benchmark, AssignAndIterateConfigs) {
+    std::cout << "Assign 1000000 components of 256 bytes, 16 distinct values, and iterate them 10 times" << std::endl;
+    assign_and_iterate_configs<config>();
+}
+
+TEST(Benchmark, AssignAndIterateSharedConfigs) {
+    std::cout << "Assign 1000000 shared components of 256 bytes, 16 distinct values, and iterate them 10 times" << std::endl;
+    assign_and_iterate_configs<shared_config>();
+}
+
+template<typename Type, typename Func>
+void write_and_publish(Func publish) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    float sum{};
+
+    registry.create<Type>(entities.begin(), entities.end());
+    timer timer;
+
+    for(auto i = 0; i < 10; ++i) {
+        registry.view<Type>().less([i](auto &instance) {
+            instance.data[0] = float(i);
+        });
+
+        publish(registry, sum);
+    }
+
+    timer.elapsed();
+    ASSERT_NE(sum, 0.f);
+}
+
+TEST(Benchmark, PublishTransformsByCopy) {
+    std::cout << "Write 1000000 transforms and copy them for the readers, 10 times" << std::endl;
+    std::vector<transform> copy{};
+
+    write_and_publish<transform>([&copy](auto &registry, auto &sum) {
+        const auto view = registry.template view<const transform>();
+        copy.assign(view.raw(), view.raw() + view.size());
+
+        for(auto &&instance: copy) {
+            sum += instance.data[0];
+        }
+    });
+}
+
+TEST(Benchmark, PublishTransformsBySwap) {
+    std::cout << "Write 1000000 transforms and swap buffers for the readers, 10 times" << std::endl;
+
+    write_and_publish<buffered_transform>([](auto &registry, auto &sum) {
+        registry.template swap_buffers<buffered_transform>();
+
+        registry.template view<const buffered_transform>().less([&sum](const auto &instance) {
+            sum += instance.data[0];
+        });
+    });
+}
+
+template<typename Type, typename Func>
+void churn_ordered(Func restore) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000000);
+    std::mt19937 gen{42u};
+    std::uint64_t next{};
+    std::uint64_t sum{};
+
+    for(auto &entity: entities) {
+        entity = registry.create();
+        registry.assign<Type>(entity, next++);
+    }
+
+    timer timer;
+
+    for(auto i = 0; i < 10; ++i) {
+        for(auto count = 0; count < 10000; ++count) {
+            auto &entity = entities[gen() % entities.size()];
+            registry.destroy(entity);
+            entity = registry.create();
+            registry.assign<Type>(entity, next++);
+        }
+
+        restore(registry);
+
+        registry.view<const Type>().each([&sum](const auto &instance) {
+            sum += instance.value;
+        });
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, ChurnAndSort) {
+    std::cout << "Churn 1000000 entities and sort them back, 10 times" << std::endl;
+
+    churn_ordered<ticket>([](auto &registry) {
+        // iterations return newer elements first, as it happens with compact
+        registry.template sort<ticket>([](const auto &lhs, const auto &rhs) {
+            return lhs.value > rhs.value;
+        });
+    });
+}
+
+TEST(Benchmark, ChurnAndCompact) {
+    std::cout << "Churn 1000000 entities and compact them, 10 times" << std::endl;
+
+    churn_ordered<stable_ticket>([](auto &registry) {
+        registry.template pool<stable_ticket>().compact();
+    });
+}
+
+template<typename Type>
+void iterate_large() {
+    entt::registry registry;
+    std::vector<entt::entity> entities(150000);
+    std::uint64_t sum{};
+
+    registry.create<Type>(entities.begin(), entities.end());
+    timer timer;
+
+    for(auto i = 0; i < 10; ++i) {
+        registry.view<const Type>().each([&sum](const auto &instance) {
+            sum += instance.data[0];
+        });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(sum, 0u);
+}
+
+TEST(Benchmark, SortLarge) {
+    std::cout << "Sort 150000 entities, one component of 256 bytes" << std::endl;
+    sort_large<large>();
+}
+
+TEST(Benchmark, SortLargeIndirect) {
+    std::cout << "Sort 150000 entities, one component of 256 bytes, indirect storage" << std::endl;
+    sort_large<large_indirect>();
+}
+
+TEST(Benchmark, GroupChurnLarge) {
+    std::cout << "Owning group churn over 150000 entities, one component of 256 bytes" << std::endl;
+    churn_large<large>();
+}
+
+TEST(Benchmark, GroupChurnLargeIndirect) {
+    std::cout << "Owning group churn over 150000 entities, one component of 256 bytes, indirect storage" << std::endl;
+    churn_large<large_indirect>();
+}
+
+TEST(Benchmark, IterateLarge) {
+    std::cout << "Iterating 10 times over 150000 entities, one component of 256 bytes" << std::endl;
+    iterate_large<large>();
+}
+
+TEST(Benchmark, IterateLargeIndirect) {
+    std::cout << "Iterating 10 times over 150000 entities, one component of 256 bytes, indirect storage" << std::endl;
+    iterate_large<large_indirect>();
+}
+
+void drawables(entt::registry &registry) {
+    std::mt19937 gen{42u};
+
+    for(std::uint64_t i = 0; i < 500000L; i++) {
+        registry.assign<drawable>(registry.create(), std::uint32_t(gen()), std::uint32_t(gen() % 64u), i);
+    }
+}
+
+TEST(Benchmark, SortDrawables) {
+    entt::registry registry;
+
+    std::cout << "Sort 500000 entities by depth, comparator" << std::endl;
+
+    drawables(registry);
+    timer timer;
+
+    registry.sort<drawable>([](const auto &lhs, const auto &rhs) {
+        return lhs.depth < rhs.depth;
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortDrawablesByKey) {
+    entt::registry registry;
+
+    std::cout << "Sort 500000 entities by depth, projection" << std::endl;
+
+    drawables(registry);
+    timer timer;
+
+    registry.sort<drawable>([](const drawable &instance) {
+        return instance.depth;
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortDrawablesByKeyRadix) {
+    entt::registry registry;
+
+    std::cout << "Sort 500000 entities by depth, projection and radix sort" << std::endl;
+
+    drawables(registry);
+    timer timer;
+
+    registry.sort<drawable>([](const drawable &instance) {
+        return instance.depth;
+    }, entt::radix_sort<8, 32>{});
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, SortDrawablesByKeyParallel) {
+    entt::registry registry;
+
+    std::cout << "Sort 500000 entities by depth, projection and parallel sort" << std::endl;
+
+    drawables(registry);
+    entt::parallel_for executor{};
+    timer timer;
+
+    registry.sort<drawable>([](const drawable &instance) {
+        return instance.depth;
+    }, entt::parallel_sort{executor});
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, AlmostSortedStdSort) {
+    entt::registry registry;
+    entt::entity entities[3];
+
+    std::cout << "Sort 150000 entities, almost sorted, std::sort" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, i, i);
+
+        if(!(i % 50000)) {
+            entities[i / 50000] = entity;
+        }
+    }
+
+    for(std::uint64_t i = 0; i < 3; ++i) {
+        registry.destroy(entities[i]);
+        const auto entity = registry.create();
+        registry.assign<position>(entity, 50000 * i, 50000 * i);
+    }
+
+    timer timer;
+
+    registry.sort<position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x > rhs.x && lhs.y > rhs.y;
+    });
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, AlmostSortedInsertionSort) {
+    entt::registry registry;
+    entt::entity entities[3];
+
+    std::cout << "Sort 150000 entities, almost sorted, insertion sort" << std::endl;
+
+    for(std::uint64_t i = 0; i < 150000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, i, i);
+
+        if(!(i % 50000)) {
+            entities[i / 50000] = entity;
+        }
+    }
+
+    for(std::uint64_t i = 0; i < 3; ++i) {
+        registry.destroy(entities[i]);
+        const auto entity = registry.create();
+        registry.assign<position>(entity, 50000 * i, 50000 * i);
+    }
+
+    timer timer;
+
+    registry.sort<position>([](const auto &lhs, const auto &rhs) {
+        return lhs.x > rhs.x && lhs.y > rhs.y;
+    }, entt::insertion_sort{});
+
+    timer.elapsed();
+}
+
+template<template<std::size_t> class Tag>
+void intersect_tags() {
+    entt::registry registry;
+    std::size_t count{};
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<Tag<0>>(entity);
+        if(i % 2) { registry.assign<Tag<1>>(entity); }
+        if(i % 3) { registry.assign<Tag<2>>(entity); }
+    }
+
+    timer timer;
+
+    for(auto i = 0; i < 10; ++i) {
+        registry.view<Tag<0>, Tag<1>, Tag<2>>().each([&count](const auto, auto...) { ++count; });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 3333330u);
+}
+
+TEST(Benchmark, IntersectTags1M) {
+    std::cout << "Intersecting three tags over 1000000 entities, 10 times" << std::endl;
+    intersect_tags<tag>();
+}
+
+TEST(Benchmark, IntersectBitsetTags1M) {
+    std::cout << "Intersecting three bitset tags over 1000000 entities, 10 times" << std::endl;
+    intersect_tags<bitset_tag>();
+}
+
+template<typename Observer>
+void observe_replace() {
+    entt::registry registry;
+    std::vector<entt::entity> entities(100000);
+    Observer observer{registry, entt::collector.replace<position>().replace<velocity>()};
+    std::size_t count{};
+
+    registry.create<position, velocity>(entities.begin(), entities.end());
+
+    timer timer;
+
+    for(auto i = 0; i < 100; ++i) {
+        for(const auto entity: entities) {
+            registry.replace<position>(entity);
+            registry.replace<velocity>(entity);
+        }
+
+        observer.each([&count](const auto) { ++count; });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 10000000u);
+}
+
+TEST(Benchmark, Observer) {
+    std::cout << "Observe 200000 replaces per frame over 100000 entities, 100 frames" << std::endl;
+    observe_replace<entt::observer>();
+}
+
+TEST(Benchmark, BatchObserver) {
+    std::cout << "Observe 200000 replaces per frame over 100000 entities, 100 frames, batch observer" << std::endl;
+    observe_replace<entt::batch_observer>();
+}
+
+bool far_from_origin(const entt::registry &, const entt::entity, const position &pos) {
+    return pos.x > 90u;
+}
+
+TEST(Benchmark, ObserverFilterInConsumer) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(100000);
+    entt::observer observer{registry, entt::collector.replace<position>()};
+    std::size_t count{};
+
+    std::cout << "Observe 100000 replaces per frame, 10% relevant, filter in the consumer, 100 frames" << std::endl;
+
+    registry.create<position>(entities.begin(), entities.end());
+    timer timer;
+
+    for(std::uint64_t i = 0; i < 100; ++i) {
+        for(std::uint64_t j = 0; j < 100000L; ++j) {
+            registry.replace<position>(entities[j], (i + j) % 100u, 0u);
+        }
+
+        observer.each([&count, &registry](const auto entity) {
+            count += (registry.get<position>(entity).x > 90u);
+        });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 900000u);
+}
+
+TEST(Benchmark, ObserverFilterInMatcher) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(100000);
+    entt::observer observer{registry, entt::collector.replace<position>().when<&far_from_origin>()};
+    std::size_t count{};
+
+    std::cout << "Observe 100000 replaces per frame, 10% relevant, filter in the matcher, 100 frames" << std::endl;
+
+    registry.create<position>(entities.begin(), entities.end());
+    timer timer;
+
+    for(std::uint64_t i = 0; i < 100; ++i) {
+        for(std::uint64_t j = 0; j < 100000L; ++j) {
+            registry.replace<position>(entities[j], (i + j) % 100u, 0u);
+        }
+
+        observer.each([&count](const auto) { ++count; });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 900000u);
+}
+
+TEST(Benchmark, RuntimeViewPerQuery) {
+    entt::registry registry;
+    entt::component types[] = { registry.type<position>(), registry.type<velocity>() };
+    std::size_t count{};
+
+    std::cout << "Run 500 runtime queries per frame over 1000 entities, exclusion in the callback, runtime view, 100 frames" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000L; i++) {
+        const auto entity = registry.create<position, velocity>();
+        if(i % 2) { registry.assign<comp<0>>(std::get<0>(entity)); }
+    }
+
+    timer timer;
+
+    for(auto i = 0; i < 50000; ++i) {
+        registry.runtime_view(std::begin(types), std::end(types)).each([&count, &registry](const auto entity) {
+            count += !registry.has<comp<0>>(entity);
+        });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 25000000u);
+}
+
+TEST(Benchmark, RuntimeQueryReused) {
+    entt::registry registry;
+    entt::component types[] = { registry.type<position>(), registry.type<velocity>() };
+    entt::component filter[] = { registry.type<comp<0>>() };
+    auto query = registry.runtime_query();
+    std::size_t count{};
+
+    std::cout << "Run 500 runtime queries per frame over 1000 entities, exclusion in the query, runtime query, 100 frames" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000L; i++) {
+        const auto entity = registry.create<position, velocity>();
+        if(i % 2) { registry.assign<comp<0>>(std::get<0>(entity)); }
+    }
+
+    query.all_of(std::begin(types), std::end(types)).none_of(std::begin(filter), std::end(filter));
+    timer timer;
+
+    for(auto i = 0; i < 50000; ++i) {
+        query.each([&count](const auto) { ++count; });
+    }
+
+    timer.elapsed();
+    ASSERT_EQ(count, 25000000u);
+}
+
+TEST(Benchmark, IterateThreeComponentsRuntimeQuery1M) {
+    entt::registry registry;
+    entt::component types[] = { registry.type<position>(), registry.type<velocity>(), registry.type<comp<0>>() };
+    auto query = registry.runtime_query();
+
+    std::cout << "Iterating over 1000000 entities, three components, runtime query with opaque pointers" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity);
+        registry.assign<velocity>(entity);
+        registry.assign<comp<0>>(entity);
+    }
+
+    query.all_of(std::begin(types), std::end(types));
+    timer timer;
+
+    query.each([](auto, void * const *instances) {
+        static_cast<position *>(instances[0])->x = {};
+        static_cast<velocity *>(instances[1])->x = {};
+        static_cast<comp<0> *>(instances[2])->x = {};
+    });
+
+    timer.elapsed();
+}
+
+struct receiver {
+    void receive(std::uint64_t value) { sum += value; }
+    std::uint64_t sum{};
+};
+
+TEST(Benchmark, SinkConnectDisconnect) {
+    entt::sigh<void(std::uint64_t)> sigh;
+    entt::sink sink{sigh};
+    std::vector<receiver> receivers(10000u);
+    std::vector<std::size_t> order(receivers.size());
+
+    std::cout << "Connecting and disconnecting 10000 listeners in random order, sink" << std::endl;
+
+    std::iota(order.begin(), order.end(), std::size_t{});
+    std::shuffle(order.begin(), order.end(), std::mt19937{});
+    timer timer;
+
+    for(auto &&instance: receivers) {
+        sink.connect<&receiver::receive>(instance);
+    }
+
+    sigh.publish(1u);
+
+    for(auto pos: order) {
+        sink.disconnect<&receiver::receive>(receivers[pos]);
+    }
+
+    timer.elapsed();
+    ASSERT_TRUE(sigh.empty());
+}
+
+TEST(Benchmark, SlotSighConnectDisconnect) {
+    entt::slot_sigh<void(std::uint64_t)> sigh;
+    std::vector<receiver> receivers(10000u);
+    std::vector<decltype(sigh)::handle_type> handles;
+    std::vector<std::size_t> order(receivers.size());
+
+    std::cout << "Connecting and disconnecting 10000 listeners in random order, slot map" << std::endl;
+
+    std::iota(order.begin(), order.end(), std::size_t{});
+    std::shuffle(order.begin(), order.end(), std::mt19937{});
+    timer timer;
+
+    for(auto &&instance: receivers) {
+        handles.push_back(sigh.connect<&receiver::receive>(instance));
+    }
+
+    sigh.publish(1u);
+
+    for(auto pos: order) {
+        sigh.disconnect(handles[pos]);
+    }
+
+    timer.elapsed();
+    ASSERT_TRUE(sigh.empty());
+}
+
+struct damage_event {
+    std::uint64_t value;
+};
+
+TEST(Benchmark, DispatcherEnqueueWithMutex) {
+    entt::dispatcher dispatcher;
+    std::mutex mutex;
+
+    std::cout << "Enqueueing 1000000 events from 4 threads, mutex" << std::endl;
+
+    timer timer;
+
+    entt::parallel_for{4u}(64u, [&dispatcher, &mutex](const std::size_t job) {
+        for(std::uint64_t i = 0; i < 1000000L / 64u; i++) {
+            std::lock_guard lock{mutex};
+            dispatcher.enqueue(damage_event{job + i});
+        }
+    });
+
+    dispatcher.update<damage_event>();
+    timer.elapsed();
+}
+
+TEST(Benchmark, DispatcherEnqueueWithLanes) {
+    entt::dispatcher dispatcher;
+
+    std::cout << "Enqueueing 1000000 events from 4 threads, lanes" << std::endl;
+
+    timer timer;
+    const auto lanes = dispatcher.lanes<damage_event>(64u);
+
+    entt::parallel_for{4u}(64u, [&lanes](const std::size_t job) {
+        for(std::uint64_t i = 0; i < 1000000L / 64u; i++) {
+            lanes.enqueue(job, damage_event{job + i});
+        }
+    });
+
+    dispatcher.update<damage_event>();
+    timer.elapsed();
+}
+
+struct cascade_event {
+    std::uint64_t data[4];
+};
+
+struct cascade_listener {
+    void receive(const cascade_event &event) {
+        if(event.data[0]) {
+            dispatcher->enqueue(cascade_event{{ event.data[0] - 1u }});
+        }
+    }
+
+    entt::dispatcher *dispatcher;
+};
+
+TEST(Benchmark, DispatcherCascade) {
+    entt::dispatcher dispatcher;
+    cascade_listener listener{&dispatcher};
+
+    std::cout << "Updating 100000 events that re-enqueue themselves 10 times" << std::endl;
+
+    dispatcher.sink<cascade_event>().connect<&cascade_listener::receive>(listener);
+
+    for(std::uint64_t i = 0; i < 100000L; i++) {
+        dispatcher.enqueue(cascade_event{{ 10u }});
+    }
+
+    timer timer;
+
+    for(auto i = 0; i < 11; ++i) {
+        dispatcher.update<cascade_event>();
+    }
+
+    timer.elapsed();
+}
+
+struct audio_listener {
+    void receive(const damage_event &event) {
+        sum += event.value;
+    }
+
+    void receive_batch(const damage_event *event, std::size_t size) {
+        for(; size; --size, ++event) {
+            sum += event->value;
+        }
+    }
+
+    std::uint64_t sum{};
+};
+
+TEST(Benchmark, DispatcherUpdate1M) {
+    entt::dispatcher dispatcher;
+    audio_listener listener;
+
+    std::cout << "Updating 1000000 events, one at a time" << std::endl;
+
+    dispatcher.sink<damage_event>().connect<&audio_listener::receive>(listener);
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        dispatcher.enqueue(damage_event{i});
+    }
+
+    timer timer;
+    dispatcher.update<damage_event>();
+    timer.elapsed();
+
+    ASSERT_EQ(listener.sum, 499999500000u);
+}
+
+TEST(Benchmark, DispatcherBatchUpdate1M) {
+    entt::dispatcher dispatcher;
+    audio_listener listener;
+
+    std::cout << "Updating 1000000 events, batch sink" << std::endl;
+
+    dispatcher.batch_sink<damage_event>().connect<&audio_listener::receive_batch>(listener);
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        dispatcher.enqueue(damage_event{i});
+    }
+
+    timer timer;
+    dispatcher.update<damage_event>();
+    timer.elapsed();
+
+    ASSERT_EQ(listener.sum, 499999500000u);
 }
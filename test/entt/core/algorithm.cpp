@@ -1,4 +1,11 @@
 #include <array>
+#include <atomic>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
 
@@ -95,3 +102,94 @@ TEST(Algorithm, RadixSortEmptyContainer) {
     // this should crash with asan enabled if we break the constraint
     sort(vec.begin(), vec.end());
 }
+
+TEST(Algorithm, RadixSortGetterConstraint) {
+    using iterator_type = std::vector<boxed_int>::iterator;
+    const auto getter = [](const boxed_int &instance) { return instance.value; };
+    const auto compare = [](const boxed_int &lhs, const boxed_int &rhs) { return lhs.value < rhs.value; };
+
+    ASSERT_TRUE((std::is_invocable_v<entt::radix_sort<8, 32>, iterator_type, iterator_type, decltype(getter)>));
+    ASSERT_FALSE((std::is_invocable_v<entt::radix_sort<8, 32>, iterator_type, iterator_type, decltype(compare)>));
+}
+
+TEST(Algorithm, ParallelFor) {
+    std::vector<std::atomic<int>> counter(1000u);
+    entt::parallel_for parallel{4u};
+
+    ASSERT_EQ(parallel.workers, 4u);
+    ASSERT_EQ(entt::parallel_for{0u}.workers, 1u);
+
+    parallel(counter.size(), [&counter](const std::size_t pos) {
+        ++counter[pos];
+    });
+
+    for(auto &&value: counter) {
+        ASSERT_EQ(value, 1);
+    }
+
+    parallel(0u, [](const std::size_t) { FAIL(); });
+
+    const auto copy = parallel;
+
+    for(auto run = 0; run < 8; ++run) {
+        copy(counter.size(), [&counter](const std::size_t pos) {
+            ++counter[pos];
+        });
+    }
+
+    for(auto &&value: counter) {
+        ASSERT_EQ(value, 9);
+    }
+}
+
+TEST(Algorithm, ParallelForException) {
+    std::atomic<std::size_t> count{};
+    entt::parallel_for parallel{4u};
+
+    ASSERT_THROW(parallel(1000u, [&count](const std::size_t pos) {
+        if(pos == 10u) {
+            throw std::runtime_error{"job"};
+        }
+
+        ++count;
+    }), std::runtime_error);
+
+    ASSERT_LE(count, 999u);
+
+    count = 0u;
+    parallel(1000u, [&count](const std::size_t) { ++count; });
+
+    ASSERT_EQ(count, 1000u);
+}
+
+TEST(Algorithm, SequentialFor) {
+    std::vector<std::size_t> jobs{};
+    entt::sequential_for{}(4u, [&jobs](const std::size_t pos) { jobs.push_back(pos); });
+
+    ASSERT_EQ(jobs, (std::vector<std::size_t>{0u, 1u, 2u, 3u}));
+}
+
+TEST(Algorithm, ParallelSort) {
+    std::vector<int> vec(3u * entt::parallel_sort::grain + 17u);
+    std::mt19937 gen{42u};
+    entt::parallel_sort sort{4u};
+
+    std::generate(vec.begin(), vec.end(), [&gen]() { return int(gen() % 1000u); });
+    sort(vec.begin(), vec.end());
+
+    ASSERT_TRUE(std::is_sorted(vec.cbegin(), vec.cend()));
+
+    std::generate(vec.begin(), vec.end(), [&gen]() { return int(gen() % 1000u); });
+    entt::parallel_sort{entt::parallel_for{4u}}(vec.begin(), vec.end(), std::greater<int>{});
+
+    ASSERT_TRUE(std::is_sorted(vec.crbegin(), vec.crend()));
+
+    sort(vec.rbegin(), vec.rend(), std::greater<int>{});
+
+    ASSERT_TRUE(std::is_sorted(vec.crbegin(), vec.crend(), std::greater<int>{}));
+
+    vec = {3, 1, 2};
+    sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, (std::vector<int>{1, 2, 3}));
+}
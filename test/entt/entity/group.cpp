@@ -1,4 +1,7 @@
+#include <chrono>
+#include <vector>
 #include <utility>
+#include <functional>
 #include <iterator>
 #include <algorithm>
 #include <type_traits>
@@ -9,6 +12,10 @@
 
 struct empty_type {};
 struct boxed_int { int value; };
+struct large_state { int data[64]; };
+
+template<>
+struct entt::storage<entt::entity, large_state>: entt::basic_indirect_storage<entt::entity, large_state> {};
 
 bool operator==(const boxed_int &lhs, const boxed_int &rhs) {
     return lhs.value == rhs.value;
@@ -234,6 +241,38 @@ TEST(NonOwningGroup, Sort) {
     ASSERT_FALSE(group.contains(e3));
 }
 
+TEST(NonOwningGroup, SortByKey) {
+    entt::registry registry;
+    auto group = registry.group(entt::get<const int, unsigned int>);
+    entt::entity entities[4]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto i = 0u; i < 4u; ++i) {
+        registry.assign<unsigned int>(entities[i], i);
+        registry.assign<int>(entities[i], int(i % 2u));
+    }
+
+    group.sort<unsigned int>([](const unsigned int value) { return 10u - value; }, entt::radix_sort<8, 8>{});
+
+    ASSERT_EQ(*(group.begin() + 0u), entities[3u]);
+    ASSERT_EQ(*(group.begin() + 1u), entities[2u]);
+    ASSERT_EQ(*(group.begin() + 2u), entities[1u]);
+    ASSERT_EQ(*(group.begin() + 3u), entities[0u]);
+
+    group.sort([](const entt::entity entity) { return to_integer(entity); });
+
+    ASSERT_EQ(*(group.begin() + 0u), entities[0u]);
+    ASSERT_EQ(*(group.begin() + 3u), entities[3u]);
+
+    group.sort<const int>([](const int value) { return -value; });
+
+    ASSERT_EQ(registry.get<int>(*(group.begin() + 0u)), 1);
+    ASSERT_EQ(registry.get<int>(*(group.begin() + 1u)), 1);
+    ASSERT_EQ(registry.get<int>(*(group.begin() + 2u)), 0);
+    ASSERT_EQ(registry.get<int>(*(group.begin() + 3u)), 0);
+}
+
 TEST(NonOwningGroup, SortAsAPool) {
     entt::registry registry;
     auto group = registry.group(entt::get<const int, unsigned int>);
@@ -497,6 +536,63 @@ TEST(NonOwningGroup, SignalRace) {
     ASSERT_EQ(registry.group(entt::get<int, double>).size(), 1u);
 }
 
+TEST(NonOwningGroup, EachWithCursor) {
+    entt::registry registry;
+    const auto group = registry.group<>(entt::get<int, char>);
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> visited;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        registry.assign<char>(entity);
+    }
+
+    group.each([&expected](const auto entity, int, char) { expected.push_back(entity); });
+
+    entt::cursor cursor{};
+
+    while(!cursor.done()) {
+        cursor = group.each(cursor, 4u, [&visited](const auto entity, int, char) { visited.push_back(entity); });
+    }
+
+    ASSERT_EQ(expected, visited);
+
+    cursor = group.each(entt::cursor{}, 8u, [](int, char) {});
+    registry.remove<char>(expected[0u]);
+    registry.remove<char>(expected[1u]);
+    registry.remove<char>(expected[2u]);
+    cursor = group.each(cursor, 8u, [](int &value, char) { value = -1; });
+
+    ASSERT_TRUE(cursor.done());
+
+    std::size_t counter{};
+    cursor = group.each(entt::cursor{}, std::chrono::steady_clock::now() + std::chrono::hours{1}, [&counter](int, char) { ++counter; });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(counter, group.size());
+}
+
+TEST(NonOwningGroup, TransformReduce) {
+    entt::registry registry;
+    auto group = registry.group(entt::get<int, const char>);
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity, 'c');
+        }
+    }
+
+    const auto sequential = group.transform_reduce(0, std::plus<>{}, [](const int value, const char) { return value; }, 8u, entt::parallel_for{1u});
+    const auto parallel = group.transform_reduce(0, std::plus<>{}, [](const auto, const int value, const char) { return value; }, 8u, entt::parallel_for{4u});
+
+    ASSERT_EQ(sequential, 2500);
+    ASSERT_EQ(parallel, sequential);
+}
+
 TEST(OwningGroup, Functionalities) {
     entt::registry registry;
     auto group = registry.group<int>(entt::get<char>);
@@ -802,6 +898,42 @@ TEST(OwningGroup, SortUnordered) {
     ASSERT_FALSE(group.contains(entities[6]));
 }
 
+TEST(OwningGroup, SortByKey) {
+    entt::registry registry;
+    auto group = registry.group<boxed_int>(entt::get<const unsigned int>);
+    entt::entity entities[5]{};
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto i = 0u; i < 5u; ++i) {
+        registry.assign<boxed_int>(entities[i], int(i));
+
+        if(i != 2u) {
+            registry.assign<unsigned int>(entities[i], 7u * i % 5u);
+        }
+    }
+
+    group.sort<boxed_int>([](const boxed_int &instance) { return -instance.value; }, entt::parallel_sort{2u});
+
+    ASSERT_EQ(group.size(), 4u);
+    ASSERT_EQ(*(group.begin() + 0u), entities[4u]);
+    ASSERT_EQ(*(group.begin() + 1u), entities[3u]);
+    ASSERT_EQ(*(group.begin() + 2u), entities[1u]);
+    ASSERT_EQ(*(group.begin() + 3u), entities[0u]);
+
+    group.sort<const unsigned int>([](const unsigned int value) { return value; });
+
+    unsigned int last{};
+
+    group.each([&last](const boxed_int &instance, const unsigned int value) {
+        ASSERT_EQ(value, 7u * unsigned(instance.value) % 5u);
+        ASSERT_LE(last, value);
+        last = value;
+    });
+
+    ASSERT_EQ(registry.get<boxed_int>(entities[2u]).value, 2);
+}
+
 TEST(OwningGroup, SortWithExclusionList) {
     entt::registry registry;
     auto group = registry.group<boxed_int>(entt::exclude<char>);
@@ -1068,3 +1200,110 @@ TEST(OwningGroup, SignalRace) {
 
     ASSERT_EQ(registry.group<int>(entt::get<double>).size(), 1u);
 }
+
+TEST(OwningGroup, EachWithCursor) {
+    entt::registry registry;
+    const auto group = registry.group<int>(entt::get<char>);
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> visited;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    group.each([&expected](const auto entity, int, char) { expected.push_back(entity); });
+
+    entt::cursor cursor{};
+
+    while(!cursor.done()) {
+        cursor = group.each(cursor, 2u, [&visited](const auto entity, int, char) { visited.push_back(entity); });
+    }
+
+    ASSERT_EQ(expected, visited);
+    ASSERT_EQ(visited.size(), 5u);
+
+    cursor = group.each(entt::cursor{}, 1u, [](int, char) {});
+
+    ASSERT_EQ(cursor.remaining(), 4u);
+
+    registry.remove<char>(expected[3u]);
+    registry.remove<char>(expected[4u]);
+    visited.clear();
+    cursor = group.each(cursor, 10u, [&visited](const auto entity, int &, char) { visited.push_back(entity); });
+
+    // the first entity is moved back into the range of candidates and visited twice
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(visited.size(), 3u);
+    ASSERT_EQ(visited[1u], expected[0u]);
+    ASSERT_EQ(std::count(visited.cbegin(), visited.cend(), expected[3u]), 0u);
+    ASSERT_EQ(std::count(visited.cbegin(), visited.cend(), expected[4u]), 0u);
+
+    cursor = group.each(entt::cursor{}, std::chrono::steady_clock::now() - std::chrono::hours{1}, [](int, char) { FAIL(); });
+
+    ASSERT_FALSE(cursor.done());
+}
+
+TEST(OwningGroup, TransformReduce) {
+    entt::registry registry;
+    auto group = registry.group<int>(entt::get<const char>);
+
+    ASSERT_EQ(group.transform_reduce(0, std::plus<>{}, [](const int value, const char) { return value; }), 0);
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity, 'c');
+        }
+    }
+
+    const auto sequential = group.transform_reduce(0, std::plus<>{}, [](const int value, const char) { return value; }, 8u, entt::parallel_for{1u});
+    const auto parallel = group.transform_reduce(0, std::plus<>{}, [](const auto, const int value, const char) { return value; }, 8u, entt::parallel_for{4u});
+
+    ASSERT_EQ(sequential, 2500);
+    ASSERT_EQ(parallel, sequential);
+}
+
+TEST(OwningGroup, IndirectStorage) {
+    entt::registry registry;
+    auto group = registry.group<large_state>(entt::get<int>);
+    std::vector<entt::entity> entities(32u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        registry.assign<large_state>(entities[i], large_state{{int(i)}});
+
+        if(i % 3u) {
+            registry.assign<int>(entities[i], int(i));
+        }
+    }
+
+    registry.remove<int>(entities[4u]);
+    registry.destroy(entities[5u]);
+
+    ASSERT_EQ(group.size(), 19u);
+
+    group.sort<large_state>([](const auto &lhs, const auto &rhs) {
+        return lhs.data[0] > rhs.data[0];
+    });
+
+    auto last = int(entities.size());
+
+    group.each([&registry, &last](const auto entity, const large_state &state, const int value) {
+        ASSERT_EQ(&state, &registry.get<large_state>(entity));
+        ASSERT_EQ(state.data[0], value);
+        ASSERT_LT(state.data[0], last);
+        last = state.data[0];
+    });
+
+    for(auto &&entity: registry.view<large_state>()) {
+        ASSERT_EQ(registry.get<large_state>(entity).data[0], int(std::find(entities.cbegin(), entities.cend(), entity) - entities.cbegin()));
+    }
+}
@@ -0,0 +1,495 @@
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <entt/entity/index.hpp>
+#include <entt/entity/registry.hpp>
+
+struct network_id {
+    unsigned int value;
+};
+
+struct asset {
+    std::string name;
+};
+
+struct position {
+    float x;
+    float y;
+};
+
+TEST(HashIndex, Functionalities) {
+    entt::registry registry;
+    auto &index = registry.index<&network_id::value>();
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.size(), 0u);
+    ASSERT_EQ(index.find(42u), static_cast<entt::entity>(entt::null));
+    ASSERT_FALSE(index.contains(42u));
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<network_id>(e0, 42u);
+    registry.assign<network_id>(e1, 3u);
+
+    ASSERT_FALSE(index.empty());
+    ASSERT_EQ(index.size(), 2u);
+    ASSERT_EQ(index.find(42u), e0);
+    ASSERT_EQ(index.find(3u), e1);
+    ASSERT_EQ(index.key(e0), 42u);
+    ASSERT_TRUE(index.contains(3u));
+    ASSERT_FALSE(index.contains(0u));
+
+    registry.replace<network_id>(e0, 7u);
+
+    ASSERT_EQ(index.size(), 2u);
+    ASSERT_EQ(index.find(42u), static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(index.find(7u), e0);
+
+    registry.patch<network_id>(e0, [](auto &id) { id.value = 8u; });
+
+    ASSERT_FALSE(index.contains(7u));
+    ASSERT_EQ(index.find(8u), e0);
+
+    registry.remove<network_id>(e1);
+
+    ASSERT_EQ(index.size(), 1u);
+    ASSERT_FALSE(index.contains(3u));
+
+    registry.destroy(e0);
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_FALSE(index.contains(7u));
+    ASSERT_EQ(&index, &registry.index<&network_id::value>());
+}
+
+TEST(HashIndex, ExistingComponents) {
+    entt::registry registry;
+
+    for(auto i = 0u; i < 10u; ++i) {
+        registry.assign<network_id>(registry.create(), i);
+    }
+
+    auto &index = registry.index<&network_id::value>();
+
+    ASSERT_EQ(index.size(), 10u);
+
+    for(auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(registry.get<network_id>(index.find(i)).value, i);
+    }
+}
+
+TEST(HashIndex, DuplicateKeys) {
+    entt::registry registry;
+    auto &index = registry.index<&asset::name>();
+    std::vector<entt::entity> expected{};
+
+    for(auto i = 0; i < 5; ++i) {
+        expected.push_back(registry.create());
+        registry.assign<asset>(expected.back(), "tree");
+        registry.assign<asset>(registry.create(), "rock");
+    }
+
+    std::vector<entt::entity> found{};
+    index.each("tree", [&found](const auto entity) { found.push_back(entity); });
+    std::sort(expected.begin(), expected.end());
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(index.size(), 10u);
+    ASSERT_EQ(found, expected);
+    ASSERT_EQ(registry.get<asset>(index.find("rock")).name, "rock");
+
+    registry.destroy(expected[2u]);
+    expected.erase(expected.begin() + 2u);
+    found.clear();
+    index.each("tree", [&found](const auto entity) { found.push_back(entity); });
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(found, expected);
+}
+
+TEST(HashIndex, Churn) {
+    entt::registry registry;
+    auto &index = registry.index<&network_id::value>();
+    std::vector<entt::entity> entities(1000u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        registry.assign<network_id>(entities[i], i);
+    }
+
+    ASSERT_GE(index.capacity(), 2u * index.size());
+
+    for(auto i = 0u; i < entities.size(); i += 3u) {
+        registry.remove<network_id>(entities[i]);
+    }
+
+    for(auto i = 1u; i < entities.size(); i += 3u) {
+        registry.replace<network_id>(entities[i], i + 1000u);
+    }
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        switch(i % 3u) {
+        case 0u:
+            ASSERT_FALSE(index.contains(i));
+            break;
+        case 1u:
+            ASSERT_FALSE(index.contains(i));
+            ASSERT_EQ(index.find(i + 1000u), entities[i]);
+            break;
+        default:
+            ASSERT_EQ(index.find(i), entities[i]);
+        }
+    }
+}
+
+TEST(HashIndex, Standalone) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.assign<network_id>(entity, 1u);
+
+    entt::hash_index<&network_id::value> index{registry};
+
+    ASSERT_EQ(index.find(1u), entity);
+
+    index.disconnect(registry);
+    registry.assign<network_id>(registry.create(), 2u);
+
+    ASSERT_FALSE(index.contains(2u));
+    ASSERT_EQ(index.size(), 1u);
+
+    index.connect(registry);
+
+    ASSERT_TRUE(index.contains(2u));
+    ASSERT_EQ(index.size(), 2u);
+
+    index.disconnect(registry);
+}
+
+TEST(OrderedIndex, Functionalities) {
+    entt::registry registry;
+    auto &index = registry.index<entt::ordered_index<&network_id::value>>();
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.begin(), index.end());
+    ASSERT_EQ(index.lower_bound(0u), index.end());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<network_id>(e0, 42u);
+    registry.assign<network_id>(e1, 3u);
+    registry.assign<network_id>(e2, 7u);
+
+    ASSERT_EQ(index.size(), 3u);
+    ASSERT_EQ(index.key(e2), 7u);
+    ASSERT_EQ(*index.begin(), e1);
+    ASSERT_EQ(*index.lower_bound(7u), e2);
+    ASSERT_EQ(*index.upper_bound(7u), e0);
+    ASSERT_EQ(index.upper_bound(42u), index.end());
+
+    registry.replace<network_id>(e1, 99u);
+
+    std::vector<entt::entity> entities{};
+    index.each([&entities](const auto entity, const network_id &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e2, e0, e1}));
+
+    registry.patch<network_id>(e2, [](auto &id) { id.value = 100u; });
+    entities.clear();
+    index.each([&entities](const auto entity, const network_id &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e0, e1, e2}));
+    ASSERT_EQ(index.key(e2), 100u);
+
+    registry.remove<network_id>(e2);
+
+    ASSERT_EQ(index.size(), 2u);
+    ASSERT_EQ(*index.begin(), e0);
+
+    registry.destroy(e0);
+    registry.destroy(e1);
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.begin(), index.end());
+}
+
+TEST(OrderedIndex, RangeQueries) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(1000u);
+    registry.create(entities.begin(), entities.end());
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        // a few keys are shared on purpose
+        registry.assign<network_id>(entities[i], (i * 7919u) % 500u);
+    }
+
+    auto &index = registry.index<entt::ordered_index<&network_id::value>>();
+
+    for(auto i = 0u; i < entities.size(); i += 2u) {
+        registry.remove<network_id>(entities[i]);
+    }
+
+    for(auto i = 1u; i < entities.size(); i += 4u) {
+        registry.replace<network_id>(entities[i], 1000u + i);
+    }
+
+    for(auto i = 0u; i < 2000u; ++i) {
+        registry.assign<network_id>(registry.create(), i % 300u);
+    }
+
+    auto count = 0u;
+    unsigned int last = 0u;
+
+    index.each([&count, &last](const network_id &id) {
+        ASSERT_LE(last, id.value);
+        last = id.value;
+        ++count;
+    });
+
+    ASSERT_EQ(count, registry.size<network_id>());
+    ASSERT_EQ(count, index.size());
+
+    count = 0u;
+
+    index.each(index.lower_bound(100u), index.upper_bound(299u), [&registry, &count](const auto entity, const network_id &id) {
+        ASSERT_GE(id.value, 100u);
+        ASSERT_LE(id.value, 299u);
+        ASSERT_EQ(registry.get<network_id>(entity).value, id.value);
+        ++count;
+    });
+
+    auto expected = 0u;
+
+    registry.view<network_id>().each([&expected](const network_id &id) {
+        expected += (id.value >= 100u && id.value <= 299u);
+    });
+
+    ASSERT_EQ(count, expected);
+}
+
+TEST(OrderedIndex, Churn) {
+    entt::registry registry;
+    auto &index = registry.index<entt::ordered_index<&network_id::value>>();
+    std::vector<entt::entity> entities(4000u);
+
+    registry.create(entities.begin(), entities.end());
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        registry.assign<network_id>(entities[i], i);
+    }
+
+    for(auto round = 0u; round < 4u; ++round) {
+        // removes one entity out of ten and moves the others to the end of the index
+        for(auto i = 0u; i < entities.size(); ++i) {
+            if(registry.has<network_id>(entities[i])) {
+                if(i % 10u == round) {
+                    registry.remove<network_id>(entities[i]);
+                } else {
+                    registry.replace<network_id>(entities[i], 4000u * (round + 1u) + i);
+                }
+            }
+        }
+
+        auto count = 0u;
+        auto last = 0u;
+
+        index.each([&count, &last](const network_id &id) {
+            ASSERT_LE(last, id.value);
+            last = id.value;
+            ++count;
+        });
+
+        ASSERT_EQ(count, index.size());
+        ASSERT_EQ(count, registry.size<network_id>());
+        ASSERT_EQ(index.lower_bound(4000u * (round + 1u)), index.begin());
+        ASSERT_EQ(index.upper_bound(4000u * (round + 2u)), index.end());
+    }
+
+    for(auto &&entity: entities) {
+        if(registry.has<network_id>(entity)) {
+            registry.remove<network_id>(entity);
+        }
+    }
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.begin(), index.end());
+}
+
+TEST(GridIndex, Functionalities) {
+    entt::registry registry;
+    auto &index = registry.index<entt::grid_index<&position::x, &position::y>>(4.f);
+
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.cell(), 4.f);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<position>(e0, 1.f, 1.f);
+    registry.assign<position>(e1, -3.f, 2.f);
+    registry.assign<position>(e2, 10.f, 10.f);
+
+    ASSERT_EQ(index.size(), 3u);
+
+    std::vector<entt::entity> found{};
+    const auto collect = [&found](const auto entity) { found.push_back(entity); };
+
+    index.each({-5.f, 0.f}, {2.f, 2.f}, collect);
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0, e1}));
+
+    found.clear();
+    index.each({0.f, 0.f}, 2.f, collect);
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0}));
+
+    registry.replace<position>(e2, 0.f, 1.5f);
+    registry.replace<position>(e0, 1.f, 0.5f);
+    found.clear();
+    index.each({0.f, 0.f}, 2.f, collect);
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0, e2}));
+
+    registry.patch<position>(e0, [](auto &pos) { pos.x = 5.f; });
+    found.clear();
+    index.each({0.f, 0.f}, 2.f, collect);
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e2}));
+
+    registry.patch<position>(e0, [](auto &pos) { pos.x = 1.f; });
+
+    registry.assign<int>(e2);
+    found.clear();
+    index.each({0.f, 0.f}, 2.f, registry.view<int>(), collect);
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e2}));
+
+    registry.destroy(e2);
+    found.clear();
+    index.each({-100.f, -100.f}, {100.f, 100.f}, collect);
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(index.size(), 2u);
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0, e1}));
+}
+
+TEST(GridIndex, PatchView) {
+    entt::registry registry;
+    auto &index = registry.index<entt::grid_index<&position::x, &position::y>>(4.f);
+
+    for(auto i = 0; i < 8; ++i) {
+        const auto entity = registry.create();
+        registry.assign<position>(entity, float(i), 0.f);
+
+        if(i % 2) {
+            registry.assign<int>(entity);
+        }
+    }
+
+    const auto view = registry.view<position, int>();
+    registry.patch<position>(view.begin(), view.end(), [](auto &pos) { pos.y = 100.f; });
+
+    std::size_t count{};
+    index.each({-1.f, 99.f}, {10.f, 101.f}, [&count, &registry](const auto entity) {
+        ASSERT_TRUE(registry.has<int>(entity));
+        ++count;
+    });
+
+    ASSERT_EQ(count, 4u);
+
+    view.each([&registry](const auto entity, const position &, const int &) {
+        registry.patch<position>(entity, [](auto &pos) { pos.y = 0.f; });
+    });
+
+    count = {};
+    index.each({-1.f, -1.f}, {10.f, 1.f}, [&count](auto) { ++count; });
+
+    ASSERT_EQ(count, 8u);
+}
+
+TEST(GridIndex, LargeQueries) {
+    entt::registry registry;
+    auto &index = registry.index<entt::grid_index<&position::x, &position::y>>(.5f);
+    std::vector<entt::entity> found{};
+    const auto collect = [&found](const auto entity) { found.push_back(entity); };
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<position>(e0, 1.f, 1.f);
+    registry.assign<position>(e1, -1e30f, 2.f);
+    registry.assign<position>(e2, 1e6f, 1e30f);
+
+    index.each({-3e38f, -3e38f}, {3e38f, 3e38f}, collect);
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0, e1, e2}));
+
+    found.clear();
+    index.each({0.f, 0.f}, 1e7f, collect);
+    std::sort(found.begin(), found.end());
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e0}));
+
+    found.clear();
+    index.each({1e6f, 1e30f}, 1.f, collect);
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e2}));
+
+    found.clear();
+    index.each({-1e30f, 0.f}, {-1e29f, 4.f}, collect);
+
+    ASSERT_EQ(found, (std::vector<entt::entity>{e1}));
+
+    found.clear();
+    index.each({2.f, 2.f}, {1e5f, 1e5f}, collect);
+
+    ASSERT_TRUE(found.empty());
+}
+
+TEST(GridIndex, Churn) {
+    entt::registry registry;
+    std::vector<entt::entity> entities(500u);
+    registry.create(entities.begin(), entities.end());
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        registry.assign<position>(entities[i], float(i % 23u) - 11.f, float(i % 17u) - 8.f);
+    }
+
+    auto &index = registry.index<entt::grid_index<&position::x, &position::y>>(2.f);
+
+    for(auto i = 0u; i < entities.size(); i += 3u) {
+        registry.remove<position>(entities[i]);
+    }
+
+    for(auto i = 1u; i < entities.size(); i += 5u) {
+        registry.assign_or_replace<position>(entities[i], float(i % 7u), -float(i % 5u));
+    }
+
+    auto view = registry.view<position>();
+
+    for(auto radius: {0.5f, 3.f, 7.f, 30.f}) {
+        std::vector<entt::entity> expected{};
+        std::vector<entt::entity> found{};
+
+        view.each([&expected, radius](const auto entity, const position &pos) {
+            if((pos.x - 1.f) * (pos.x - 1.f) + (pos.y + 2.f) * (pos.y + 2.f) <= radius * radius) {
+                expected.push_back(entity);
+            }
+        });
+
+        index.each({1.f, -2.f}, radius, [&found](const auto entity) { found.push_back(entity); });
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+
+        ASSERT_EQ(found, expected);
+    }
+}
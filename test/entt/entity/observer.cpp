@@ -1,4 +1,5 @@
 #include <tuple>
+#include <vector>
 #include <cstddef>
 #include <type_traits>
 #include <gtest/gtest.h>
@@ -338,3 +339,193 @@ TEST(Observer, MultipleFilters) {
 
     ASSERT_TRUE(observer.empty());
 }
+
+TEST(BatchObserver, Functionalities) {
+    entt::registry registry;
+    entt::batch_observer observer{registry, entt::collector.group<int>().replace<char>()};
+
+    ASSERT_EQ(observer.size(), 0u);
+    ASSERT_TRUE(observer.empty());
+    ASSERT_EQ(observer.begin(), observer.end());
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<char>(e0);
+    registry.assign<char>(e1);
+    registry.replace<char>(e0);
+    registry.replace<char>(e1);
+    registry.replace<char>(e1);
+
+    ASSERT_EQ(observer.size(), 2u);
+    ASSERT_EQ(observer.data()[0u], e0);
+    ASSERT_EQ(observer.data()[1u], e1);
+
+    registry.remove<int>(e0);
+
+    ASSERT_EQ(observer.size(), 2u);
+
+    registry.remove<char>(e0);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.begin(), e1);
+
+    registry.destroy(e1);
+    const auto e2 = std::get<0>(registry.create<char>());
+    registry.replace<char>(e2);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.begin(), e2);
+    ASSERT_NE(e2, e1);
+
+    observer.each([e2](const auto entt) {
+        ASSERT_EQ(entt, e2);
+    });
+
+    ASSERT_TRUE(observer.empty());
+
+    observer.disconnect();
+    registry.replace<char>(e2);
+
+    ASSERT_TRUE(observer.empty());
+}
+
+TEST(BatchObserver, ManyMatchers) {
+    constexpr auto collector = entt::collector
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>().group<int>()
+            .replace<char>();
+
+    entt::registry registry;
+    entt::batch_observer observer{registry, collector};
+    const auto entity = registry.create();
+
+    registry.assign<char>(entity);
+    registry.replace<char>(entity);
+
+    ASSERT_EQ(observer.size(), 1u);
+
+    registry.assign<int>(entity);
+    registry.remove<char>(entity);
+
+    ASSERT_EQ(observer.size(), 1u);
+
+    registry.remove<int>(entity);
+
+    ASSERT_TRUE(observer.empty());
+}
+
+TEST(BatchObserver, EachChunk) {
+    entt::registry registry;
+    entt::batch_observer observer{};
+    std::vector<entt::entity> entities(10u);
+
+    observer.connect(registry, entt::collector.group<int>());
+    registry.create<int>(entities.begin(), entities.end());
+
+    std::size_t calls{};
+    std::vector<entt::entity> collected{};
+
+    observer.each_chunk([&calls, &collected](const auto *first, const auto count) {
+        collected.insert(collected.end(), first, first + count);
+        ++calls;
+    }, 4u);
+
+    ASSERT_EQ(calls, 3u);
+    ASSERT_EQ(collected, entities);
+
+    observer.clear();
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.replace<int>(entities[3u]);
+    registry.remove<int>(entities[5u]);
+    registry.assign<int>(entities[5u]);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.data(), entities[5u]);
+
+    registry.remove<int>(entities[1u]);
+    registry.assign<int>(entities[1u]);
+    registry.remove<int>(entities[5u]);
+    observer.collect();
+
+    const auto &cobserver = observer;
+    collected.clear();
+
+    ASSERT_EQ(cobserver.size(), 1u);
+    ASSERT_EQ(*cobserver.begin(), entities[1u]);
+
+    cobserver.each_chunk([&collected](const auto *first, const auto count) {
+        collected.insert(collected.end(), first, first + count);
+    });
+
+    ASSERT_EQ(collected, (std::vector<entt::entity>{entities[1u]}));
+}
+
+bool is_positive(const entt::registry &registry, const entt::entity entity) {
+    return registry.get<int>(entity) > 0;
+}
+
+bool exceeds_threshold(const entt::registry &, const entt::entity, const double &value) {
+    return value > 10.;
+}
+
+TEST(Observer, PredicateFilters) {
+    constexpr auto collector = entt::collector
+            .group<int>().when<&is_positive>()
+            .replace<double>().where<char>().when<&exceeds_threshold>();
+
+    entt::registry registry;
+    entt::observer observer{registry, collector};
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.assign<int>(entity, 0);
+    registry.assign<int>(other, 1);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.data(), other);
+
+    observer.clear();
+    registry.assign<double>(entity, 0.);
+    registry.assign<char>(entity);
+    registry.replace<double>(entity, 1.);
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.replace<double>(entity, 100.);
+
+    ASSERT_EQ(observer.size(), 1u);
+    ASSERT_EQ(*observer.data(), entity);
+
+    registry.patch<double>(entity, [](auto &value) { value = 5.; });
+
+    ASSERT_EQ(observer.size(), 1u);
+
+    registry.remove<double>(entity);
+
+    ASSERT_TRUE(observer.empty());
+}
+
+TEST(BatchObserver, PredicateFilters) {
+    entt::registry registry;
+    entt::batch_observer observer{registry, entt::collector.replace<double>().when<&exceeds_threshold>()};
+    const auto entity = registry.create();
+
+    registry.assign<double>(entity, 0.);
+    registry.replace<double>(entity, 1.);
+
+    ASSERT_TRUE(observer.empty());
+
+    registry.replace<double>(entity, 100.);
+
+    ASSERT_EQ(observer.size(), 1u);
+}
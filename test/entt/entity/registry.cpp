@@ -36,6 +36,46 @@ struct listener {
     int counter{0};
 };
 
+struct shared_type {
+    int value;
+
+    bool operator==(const shared_type &other) const {
+        return value == other.value;
+    }
+};
+
+template<>
+struct std::hash<shared_type> {
+    std::size_t operator()(const shared_type &instance) const {
+        return std::hash<int>{}(instance.value);
+    }
+};
+
+template<>
+struct entt::storage<entt::entity, shared_type>: entt::basic_shared_storage<entt::entity, shared_type> {};
+
+struct buffered_type {
+    int value;
+};
+
+template<>
+struct entt::storage<entt::entity, buffered_type>: entt::basic_buffered_storage<entt::entity, buffered_type> {};
+
+struct stable_type {
+    int value;
+};
+
+template<>
+struct entt::storage<entt::entity, stable_type>: entt::basic_stable_storage<entt::entity, stable_type> {};
+
+struct last_value_listener {
+    void update(entt::entity, entt::registry &, const int &instance) {
+        value = instance;
+    }
+
+    int value{};
+};
+
 TEST(Registry, Context) {
     entt::registry registry;
 
@@ -795,6 +835,38 @@ TEST(Registry, SortSingle) {
     }
 }
 
+TEST(Registry, SortByKey) {
+    entt::registry registry;
+
+    for(auto i = 0u; i < 100u; ++i) {
+        registry.assign<unsigned int>(registry.create(), (i * 37u) % 100u);
+    }
+
+    registry.sort<unsigned int>([](const unsigned int value) { return value; }, entt::radix_sort<8, 32>{});
+
+    unsigned int last{};
+
+    registry.view<unsigned int>().each([&last](const unsigned int value) {
+        ASSERT_LE(last, value);
+        last = value;
+    });
+
+    entt::parallel_for executor{2u};
+    registry.sort<unsigned int>(std::greater<unsigned int>{}, entt::parallel_sort{executor});
+
+    registry.view<unsigned int>().each([&last](const unsigned int value) {
+        ASSERT_GE(last, value);
+        last = value;
+    });
+
+    registry.sort<unsigned int>([](const unsigned int value) { return value; }, entt::parallel_sort{executor});
+
+    registry.view<unsigned int>().each([&last](const unsigned int value) {
+        ASSERT_LE(last, value);
+        last = value;
+    });
+}
+
 TEST(Registry, SortMulti) {
     entt::registry registry;
 
@@ -827,6 +899,153 @@ TEST(Registry, SortMulti) {
     }
 }
 
+TEST(Registry, RespectMulti) {
+    entt::registry registry;
+
+    for(auto i = 0; i < 3; ++i) {
+        const auto entity = registry.create();
+        registry.assign<unsigned int>(entity, i);
+        registry.assign<int>(entity, i);
+        registry.assign<char>(entity, static_cast<char>(i));
+    }
+
+    registry.sort<unsigned int>(std::less<unsigned int>{});
+    registry.respect<int, char, unsigned int>();
+
+    unsigned int uval{};
+    int ival{};
+    char cval{};
+
+    for(auto entity: registry.view<unsigned int>()) {
+        ASSERT_EQ(registry.get<unsigned int>(entity), uval++);
+    }
+
+    for(auto entity: registry.view<int>()) {
+        ASSERT_EQ(registry.get<int>(entity), ival++);
+    }
+
+    for(auto entity: registry.view<char>()) {
+        ASSERT_EQ(registry.get<char>(entity), cval++);
+    }
+
+    registry.sort<unsigned int>(std::greater<unsigned int>{});
+    registry.respect<int, unsigned int>();
+
+    for(auto entity: registry.view<int>()) {
+        ASSERT_EQ(registry.get<int>(entity), --ival);
+    }
+}
+
+TEST(Registry, SharedComponents) {
+    entt::registry registry;
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+
+    registry.assign<shared_type>(e0, 3);
+    const auto &instance = registry.assign<shared_type>(e1, 3);
+
+    static_assert(std::is_same_v<decltype(registry.get<shared_type>(e0)), const shared_type &>);
+
+    ASSERT_EQ(&registry.get<shared_type>(e0), &instance);
+    ASSERT_EQ(registry.pool<shared_type>().unique(), 1u);
+
+    registry.replace<shared_type>(e0, 42);
+
+    ASSERT_EQ(registry.get<shared_type>(e0).value, 42);
+    ASSERT_EQ(registry.get<shared_type>(e1).value, 3);
+
+    registry.patch<shared_type>(e1, [](auto &component) { component.value = 42; });
+
+    ASSERT_EQ(&registry.get<shared_type>(e0), &registry.get<shared_type>(e1));
+    ASSERT_EQ(registry.pool<shared_type>().unique(), 1u);
+
+    std::size_t count{};
+
+    registry.view<const shared_type>().each([&count](const auto &component) {
+        ASSERT_EQ(component.value, 42);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+
+    auto other = registry.clone();
+
+    ASSERT_EQ(&other.get<shared_type>(e0), &other.get<shared_type>(e1));
+    ASSERT_NE(&other.get<shared_type>(e0), &registry.get<shared_type>(e0));
+
+    registry.assign_or_replace<shared_type>(e0, 0);
+    registry.remove<shared_type>(e1);
+
+    ASSERT_EQ(registry.get<shared_type>(e0).value, 0);
+    ASSERT_EQ(registry.pool<shared_type>().unique(), 1u);
+}
+
+TEST(Registry, SwapBuffers) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.assign<buffered_type>(entity, 1);
+    registry.assign<int>(entity, 0);
+
+    registry.view<buffered_type>().each([](auto &component) {
+        component.value = 42;
+    });
+
+    registry.view<const buffered_type, int>().each([](const auto &component, auto &value) {
+        value = component.value;
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 1);
+    ASSERT_EQ(std::as_const(registry).get<buffered_type>(entity).value, 1);
+
+    registry.swap_buffers<buffered_type>();
+
+    registry.view<const buffered_type, int>().each([](const auto &component, auto &value) {
+        value = component.value;
+    });
+
+    ASSERT_EQ(registry.get<int>(entity), 42);
+    ASSERT_EQ(registry.get<buffered_type>(entity).value, 1);
+
+    registry.view<buffered_type>().each([](auto &component) {
+        ++component.value;
+    });
+
+    ASSERT_EQ(std::as_const(registry).get<buffered_type>(entity).value, 42);
+
+    registry.swap_buffers<buffered_type>(true);
+
+    ASSERT_EQ(std::as_const(registry).get<buffered_type>(entity).value, 2);
+    ASSERT_EQ(registry.get<buffered_type>(entity).value, 2);
+}
+
+TEST(Registry, Compact) {
+    entt::registry registry;
+    entt::entity entities[3u];
+
+    registry.create(std::begin(entities), std::end(entities));
+
+    for(auto i = 0; i < 3; ++i) {
+        registry.assign<stable_type>(entities[i], i);
+    }
+
+    registry.remove<stable_type>(entities[0u]);
+    registry.assign<stable_type>(entities[0u], 3);
+
+    ASSERT_EQ(registry.raw<stable_type>()[0u].value, 2);
+
+    registry.compact<stable_type>();
+
+    ASSERT_EQ(registry.raw<stable_type>()[0u].value, 1);
+    ASSERT_EQ(registry.raw<stable_type>()[1u].value, 2);
+    ASSERT_EQ(registry.raw<stable_type>()[2u].value, 3);
+
+    registry.group<int>(entt::get<stable_type>);
+    registry.compact<stable_type>();
+
+    ASSERT_EQ(registry.raw<stable_type>()[0u].value, 1);
+}
+
 TEST(Registry, ComponentsWithTypesFromStandardTemplateLibrary) {
     // see #37 - the test shouldn't crash, that's all
     entt::registry registry;
@@ -1008,6 +1227,12 @@ TEST(Registry, Signals) {
 
     ASSERT_EQ(listener.counter, 6);
     ASSERT_EQ(listener.last, e0);
+
+    registry.patch<empty_type>(e0);
+    registry.patch<int>(e0);
+
+    ASSERT_EQ(listener.counter, 8);
+    ASSERT_EQ(listener.last, e0);
 }
 
 TEST(Registry, RangeDestroy) {
@@ -1111,6 +1336,46 @@ TEST(Registry, RangeRemove) {
     ASSERT_TRUE(registry.has<int>(e2));
 }
 
+TEST(Registry, Patch) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.assign<int>(entity, 3);
+
+    last_value_listener listener;
+    registry.on_replace<int>().connect<&last_value_listener::update>(listener);
+
+    auto &instance = registry.patch<int>(entity, [](auto &curr) { curr *= 2; }, [](auto &curr) { ++curr; });
+
+    ASSERT_EQ(&instance, &registry.get<int>(entity));
+    ASSERT_EQ(instance, 7);
+    ASSERT_EQ(listener.value, 7);
+}
+
+TEST(Registry, RangePatch) {
+    entt::registry registry;
+    listener listener;
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.assign<int>(e1, 1);
+    registry.assign<int>(e2, 2);
+    registry.assign<char>(e0);
+    registry.assign<char>(e2);
+
+    registry.on_replace<int>().connect<&listener::incr<int>>(listener);
+
+    const auto view = registry.view<int, char>();
+    registry.patch<int>(view.begin(), view.end(), [](auto &instance) { instance += 10; });
+
+    ASSERT_EQ(registry.get<int>(e0), 10);
+    ASSERT_EQ(registry.get<int>(e1), 1);
+    ASSERT_EQ(registry.get<int>(e2), 12);
+    ASSERT_EQ(listener.counter, 2);
+}
+
 TEST(Registry, CreateManyEntitiesAtOnce) {
     entt::registry registry;
     entt::entity entities[3];
@@ -1,9 +1,42 @@
+#include <chrono>
+#include <vector>
 #include <iterator>
 #include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <gtest/gtest.h>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
 
+struct tracked { int value; };
+
+template<>
+struct entt::storage<entt::entity, tracked>: entt::basic_tick_storage<entt::entity, tracked> {};
+
+struct shared {
+    int value;
+
+    bool operator==(const shared &other) const {
+        return value == other.value;
+    }
+};
+
+template<>
+struct std::hash<shared> {
+    std::size_t operator()(const shared &instance) const {
+        return std::hash<int>{}(instance.value);
+    }
+};
+
+template<>
+struct entt::storage<entt::entity, shared>: entt::basic_shared_storage<entt::entity, shared> {};
+
+struct buffered { int value; };
+
+template<>
+struct entt::storage<entt::entity, buffered>: entt::basic_buffered_storage<entt::entity, buffered> {};
+
 TEST(RuntimeView, Functionalities) {
     entt::registry registry;
 
@@ -132,6 +165,44 @@ TEST(RuntimeView, Each) {
     ASSERT_EQ(cnt, std::size_t{2});
 }
 
+TEST(RuntimeView, EachWithCursor) {
+    entt::registry registry;
+
+    for(auto i = 0; i < 10; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+    }
+
+    entt::component types[] = { registry.type<int>(), registry.type<char>() };
+    auto view = registry.runtime_view(std::begin(types), std::end(types));
+    entt::cursor cursor{};
+    std::size_t cnt{};
+
+    while(!cursor.done()) {
+        cursor = view.each(cursor, 2u, [&cnt, &registry](const auto entity) {
+            ASSERT_TRUE((registry.has<int, char>(entity)));
+            ++cnt;
+        });
+    }
+
+    ASSERT_EQ(cnt, 5u);
+
+    cnt = {};
+    cursor = view.each(entt::cursor{}, std::chrono::steady_clock::now() + std::chrono::hours{1}, [&cnt](auto) { ++cnt; });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(cnt, 5u);
+
+    entt::component missing[] = { registry.type<int>(), registry.type<double>() };
+    cursor = registry.runtime_view(std::begin(missing), std::end(missing)).each(entt::cursor{}, 10u, [](auto) { FAIL(); });
+
+    ASSERT_TRUE(cursor.done());
+}
+
 TEST(RuntimeView, EachWithHoles) {
     entt::registry registry;
 
@@ -193,3 +264,233 @@ TEST(RuntimeView, EmptyRange) {
 
     ASSERT_EQ((std::find(view.begin(), view.end(), e0)), view.end());
 }
+
+TEST(RuntimeQuery, Functionalities) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+
+    const entt::component all[] = { registry.type<int>(), registry.type<char>() };
+    const entt::component none[] = { registry.type<double>() };
+    query.all_of(std::begin(all), std::end(all)).none_of(std::begin(none), std::end(none));
+
+    ASSERT_EQ(query.size_hint(), 0u);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<int>(e0, 0);
+    registry.assign<char>(e0, 'c');
+    registry.assign<int>(e1, 1);
+    registry.assign<char>(e1, 'c');
+    registry.assign<double>(e1);
+    registry.assign<int>(e2, 2);
+
+    ASSERT_EQ(query.size_hint(), 2u);
+    ASSERT_TRUE(query.contains(e0));
+    ASSERT_FALSE(query.contains(e1));
+    ASSERT_FALSE(query.contains(e2));
+
+    std::vector<entt::entity> entities{};
+
+    query.each([&entities](const auto entity) {
+        entities.push_back(entity);
+    });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e0}));
+
+    registry.remove<double>(e1);
+    registry.get<int>(e1) = 42;
+    auto count = 0u;
+
+    query.each([&count, e1](const auto entity, const void * const *instances) {
+        if(entity == e1) {
+            ASSERT_EQ(*static_cast<const int *>(instances[0]), 42);
+        }
+
+        ASSERT_EQ(*static_cast<const char *>(instances[1]), 'c');
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+}
+
+TEST(RuntimeQuery, AnyOf) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+
+    const entt::component any[] = { registry.type<int>(), registry.type<char>() };
+    const entt::component none[] = { registry.type<double>() };
+    query.any_of(std::begin(any), std::end(any)).none_of(std::begin(none), std::end(none));
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+    const auto e3 = registry.create();
+
+    registry.assign<int>(e0);
+    registry.assign<int>(e1);
+    registry.assign<char>(e1);
+    registry.assign<char>(e2);
+    registry.assign<char>(e3);
+    registry.assign<double>(e3);
+
+    std::vector<entt::entity> entities{};
+    query.each([&entities](const auto entity) { entities.push_back(entity); });
+    std::sort(entities.begin(), entities.end());
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e0, e1, e2}));
+    ASSERT_TRUE(query.contains(e2));
+    ASSERT_FALSE(query.contains(e3));
+
+    const entt::component all[] = { registry.type<char>() };
+    query.all_of(std::begin(all), std::end(all));
+    entities.clear();
+    query.each([&entities](const auto entity) { entities.push_back(entity); });
+    std::sort(entities.begin(), entities.end());
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e1, e2}));
+}
+
+TEST(RuntimeQuery, MissingPool) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+
+    const entt::component all[] = { registry.type<int>(), registry.type<char>() };
+    query.all_of(std::begin(all), std::end(all));
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity);
+
+    ASSERT_FALSE(query.contains(entity));
+    query.each([](auto) { FAIL(); });
+
+    registry.assign<char>(entity);
+
+    ASSERT_TRUE(query.contains(entity));
+    ASSERT_EQ(query.size_hint(), 1u);
+}
+
+TEST(RuntimeQuery, ConstFunctionsFromCallback) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+
+    const entt::component all[] = { registry.type<int>(), registry.type<char>() };
+    query.all_of(std::begin(all), std::end(all));
+
+    for(auto i = 0; i < 4; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity, static_cast<char>('a' + i));
+        }
+    }
+
+    const auto &cquery = query;
+
+    query.each([&registry, &cquery](const auto entity, void * const *instances) {
+        ASSERT_EQ(cquery.size_hint(), 2u);
+        ASSERT_TRUE(cquery.contains(entity));
+        ASSERT_EQ(instances[0], &registry.get<int>(entity));
+        ASSERT_EQ(instances[1], &registry.get<char>(entity));
+    });
+
+    const auto entity = registry.create();
+    const entt::component none[] = { registry.type<double>() };
+    query.none_of(std::begin(none), std::end(none));
+    registry.assign<int>(entity);
+    registry.assign<char>(entity);
+
+    ASSERT_TRUE(cquery.contains(entity));
+
+    registry.assign<double>(entity);
+
+    ASSERT_FALSE(cquery.contains(entity));
+    ASSERT_EQ(cquery.size_hint(), 3u);
+}
+
+TEST(RuntimeQuery, EachWithPointers) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+
+    const entt::component all[] = { registry.type<int>(), registry.type<char>(), registry.type<tracked>() };
+    query.all_of(std::begin(all), std::end(all));
+
+    for(auto i = 0; i < 5; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        registry.assign<tracked>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity, static_cast<char>('a' + i));
+        }
+    }
+
+    // the pool of chars leads the iteration, the others follow a different order
+    registry.sort<int>(std::greater<int>{});
+
+    query.each([](const auto, void * const *instances) {
+        *static_cast<int *>(instances[0]) += 10;
+        ASSERT_EQ(*static_cast<char *>(instances[1]), static_cast<char>('a' + *static_cast<int *>(instances[0]) - 10));
+        ASSERT_EQ(static_cast<tracked *>(instances[2])->value, *static_cast<int *>(instances[0]) - 10);
+    });
+
+    registry.view<const int>().each([&registry](const auto entity, const int &value) {
+        ASSERT_EQ(value, registry.has<char>(entity) ? registry.get<tracked>(entity).value + 10 : registry.get<tracked>(entity).value);
+    });
+}
+
+TEST(RuntimeQuery, EachWithWriteAccess) {
+    entt::registry registry;
+    auto query = registry.runtime_query();
+    const entt::component all[] = { registry.type<tracked>(), registry.type<shared>(), registry.type<buffered>() };
+
+    query.all_of(std::begin(all), std::end(all));
+
+    const auto entity = registry.create();
+    registry.assign<tracked>(entity, 0);
+    registry.assign<shared>(entity, 0);
+    registry.assign<buffered>(entity, 0);
+
+    const auto since = registry.pool<tracked>().checkpoint();
+
+    query.each([](const auto, void * const *instances) {
+        ASSERT_NE(instances[0], nullptr);
+        ASSERT_EQ(instances[1], nullptr);
+        ASSERT_NE(instances[2], nullptr);
+
+        static_cast<tracked *>(instances[0])->value = 42;
+        static_cast<buffered *>(instances[2])->value = 42;
+    });
+
+    ASSERT_GT(std::as_const(registry).pool<tracked>().changed(entity), since);
+    ASSERT_EQ(std::as_const(registry).get<tracked>(entity).value, 42);
+    ASSERT_EQ(std::as_const(registry).get<buffered>(entity).value, 0);
+    ASSERT_EQ(registry.get<buffered>(entity).value, 42);
+
+    std::as_const(registry).runtime_query().all_of(std::begin(all), std::end(all)).each([](const auto, const void * const *instances) {
+        ASSERT_EQ(static_cast<const tracked *>(instances[0])->value, 42);
+        ASSERT_EQ(static_cast<const shared *>(instances[1])->value, 0);
+        ASSERT_EQ(static_cast<const buffered *>(instances[2])->value, 0);
+    });
+}
+
+TEST(RuntimeQuery, Const) {
+    entt::registry registry;
+    auto query = std::as_const(registry).runtime_query();
+    const entt::component all[] = { registry.type<int>() };
+
+    static_assert(std::is_same_v<decltype(query), entt::basic_runtime_query<entt::entity, true>>);
+    static_assert(std::is_same_v<decltype(registry.runtime_query()), entt::runtime_query>);
+
+    query.all_of(std::begin(all), std::end(all));
+
+    const auto entity = registry.create();
+    registry.assign<int>(entity, 42);
+
+    query.each([entity](const auto entt, const void * const *instances) {
+        ASSERT_EQ(entt, entity);
+        ASSERT_EQ(*static_cast<const int *>(instances[0]), 42);
+    });
+}
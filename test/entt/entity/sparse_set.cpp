@@ -347,6 +347,35 @@ TEST(SparseSet, SortUnordered) {
     ASSERT_EQ(begin, end);
 }
 
+TEST(SparseSet, SortByKey) {
+    entt::sparse_set<entt::entity> set;
+    entt::entity entities[5]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+
+    set.construct(std::begin(entities), std::end(entities));
+    set.sort(set.begin(), set.end(), [](const entt::entity entt) { return 100u - to_integer(entt); });
+
+    ASSERT_EQ(*(set.data() + 0u), entt::entity{3});
+    ASSERT_EQ(*(set.data() + 1u), entt::entity{7});
+    ASSERT_EQ(*(set.data() + 2u), entt::entity{9});
+    ASSERT_EQ(*(set.data() + 3u), entt::entity{12});
+    ASSERT_EQ(*(set.data() + 4u), entt::entity{42});
+
+    set.sort(set.begin(), set.end(), [](const entt::entity entt) { return to_integer(entt); }, entt::radix_sort<8, 32>{});
+
+    auto begin = set.begin();
+
+    ASSERT_EQ(*(begin++), entt::entity{3});
+    ASSERT_EQ(*(begin++), entt::entity{7});
+    ASSERT_EQ(*(begin++), entt::entity{9});
+    ASSERT_EQ(*(begin++), entt::entity{12});
+    ASSERT_EQ(*(begin++), entt::entity{42});
+    ASSERT_EQ(begin, set.end());
+
+    for(auto &&entt: entities) {
+        ASSERT_EQ(set.data()[set.index(entt)], entt);
+    }
+}
+
 TEST(SparseSet, SortRange) {
     entt::sparse_set<entt::entity> set;
 
@@ -709,6 +738,43 @@ TEST(SparseSet, RespectUnordered) {
     ASSERT_EQ(rhs.index(entt::entity{5}), 5u);
 }
 
+TEST(SparseSet, RespectMultiple) {
+    entt::sparse_set<entt::entity> master;
+    entt::sparse_set<entt::entity> lhs;
+    entt::sparse_set<entt::entity> rhs;
+    entt::sparse_set<entt::entity> other;
+
+    master.construct(entt::entity{5});
+    master.construct(entt::entity{3});
+    master.construct(entt::entity{1});
+    master.construct(entt::entity{4});
+
+    for(auto *set: {&lhs, &rhs, &other}) {
+        set->construct(entt::entity{1});
+        set->construct(entt::entity{2});
+        set->construct(entt::entity{3});
+        set->construct(entt::entity{4});
+    }
+
+    rhs.swap(entt::entity{1}, entt::entity{2});
+    other.destroy(entt::entity{4});
+    other.construct(entt::entity{5});
+
+    lhs.respect(master, rhs, other);
+
+    for(auto *set: {&lhs, &rhs}) {
+        ASSERT_EQ(set->index(entt::entity{2}), 0u);
+        ASSERT_EQ(set->index(entt::entity{3}), 1u);
+        ASSERT_EQ(set->index(entt::entity{1}), 2u);
+        ASSERT_EQ(set->index(entt::entity{4}), 3u);
+    }
+
+    ASSERT_EQ(other.index(entt::entity{2}), 0u);
+    ASSERT_EQ(other.index(entt::entity{5}), 1u);
+    ASSERT_EQ(other.index(entt::entity{3}), 2u);
+    ASSERT_EQ(other.index(entt::entity{1}), 3u);
+}
+
 TEST(SparseSet, CanModifyDuringIteration) {
     entt::sparse_set<entt::entity> set;
     set.construct(entt::entity{0});
@@ -724,3 +790,17 @@ TEST(SparseSet, CanModifyDuringIteration) {
     const auto entity = *it;
     (void)entity;
 }
+
+TEST(SparseSet, Prefetch) {
+    entt::sparse_set<entt::entity> set;
+    constexpr auto entt_per_page = ENTT_PAGE_SIZE / sizeof(std::underlying_type_t<entt::entity>);
+
+    set.prefetch(entt::entity{0});
+    set.construct(entt::entity{42});
+    set.prefetch(entt::entity{42});
+    set.prefetch(entt::entity{entt_per_page});
+
+    ASSERT_TRUE(set.has(entt::entity{42}));
+    ASSERT_FALSE(set.has(entt::entity{entt_per_page}));
+    ASSERT_EQ(set.size(), 1u);
+}
@@ -1,7 +1,10 @@
 #include <memory>
+#include <vector>
 #include <utility>
 #include <iterator>
+#include <algorithm>
 #include <exception>
+#include <functional>
 #include <type_traits>
 #include <unordered_set>
 #include <gtest/gtest.h>
@@ -11,6 +14,23 @@
 struct empty_type {};
 struct boxed_int { int value; };
 
+struct shared_config {
+    int id;
+    int value;
+};
+
+struct shared_config_hash {
+    std::size_t operator()(const shared_config &config) const {
+        return std::hash<int>{}(config.id);
+    }
+};
+
+struct shared_config_equal {
+    bool operator()(const shared_config &lhs, const shared_config &rhs) const {
+        return lhs.id == rhs.id;
+    }
+};
+
 struct throwing_component {
     struct constructor_exception: std::exception {};
 
@@ -445,6 +465,42 @@ TEST(Storage, SortUnordered) {
     ASSERT_EQ(begin, end);
 }
 
+TEST(Storage, SortByKey) {
+    entt::storage<entt::entity, boxed_int> pool;
+    entt::entity entities[5]{entt::entity{12}, entt::entity{42}, entt::entity{7}, entt::entity{3}, entt::entity{9}};
+
+    pool.construct(std::begin(entities), std::end(entities));
+
+    for(auto &&entt: entities) {
+        pool.get(entt).value = int(to_integer(entt)) % 10;
+    }
+
+    pool.sort(pool.begin(), pool.end(), [](const boxed_int &instance) { return instance.value; });
+
+    auto begin = pool.begin();
+
+    ASSERT_EQ((begin++)->value, 2);
+    ASSERT_EQ((begin++)->value, 2);
+    ASSERT_EQ((begin++)->value, 3);
+    ASSERT_EQ((begin++)->value, 7);
+    ASSERT_EQ((begin++)->value, 9);
+    ASSERT_EQ(begin, pool.end());
+
+    pool.sort(pool.begin(), pool.end(), [](const boxed_int &instance) { return 10u - unsigned(instance.value); }, entt::radix_sort<8, 8>{});
+
+    for(auto &&entt: entities) {
+        ASSERT_EQ(pool.get(entt).value, int(to_integer(entt)) % 10);
+    }
+
+    ASSERT_EQ(pool.begin()->value, 9);
+    ASSERT_EQ((pool.end() - 1)->value, 2);
+
+    pool.sort(pool.begin(), pool.end(), [](const entt::entity entt) { return to_integer(entt); }, entt::parallel_sort{2u});
+
+    ASSERT_EQ(*pool.sparse_set<entt::entity>::begin(), entt::entity{3});
+    ASSERT_EQ(pool.begin()->value, 3);
+}
+
 TEST(Storage, SortRange) {
     entt::storage<entt::entity, boxed_int> pool;
 
@@ -705,6 +761,37 @@ TEST(Storage, RespectUnordered) {
     ASSERT_EQ(*(rhs.data() + 5u), entt::entity{5});
 }
 
+TEST(Storage, RespectMultiple) {
+    entt::sparse_set<entt::entity> master;
+    entt::storage<entt::entity, int> lhs;
+    entt::storage<entt::entity, char> rhs;
+
+    master.construct(entt::entity{2});
+    master.construct(entt::entity{0});
+    master.construct(entt::entity{1});
+
+    for(auto value = 0; value < 3; ++value) {
+        lhs.construct(entt::entity(value), value);
+        rhs.construct(entt::entity(2 - value), static_cast<char>('a' + value));
+    }
+
+    lhs.respect(master, rhs);
+
+    ASSERT_EQ(*(lhs.data() + 0u), entt::entity{2});
+    ASSERT_EQ(*(lhs.data() + 1u), entt::entity{0});
+    ASSERT_EQ(*(lhs.data() + 2u), entt::entity{1});
+    ASSERT_EQ(*(lhs.raw() + 0u), 2);
+    ASSERT_EQ(*(lhs.raw() + 1u), 0);
+    ASSERT_EQ(*(lhs.raw() + 2u), 1);
+
+    ASSERT_EQ(*(rhs.data() + 0u), entt::entity{2});
+    ASSERT_EQ(*(rhs.data() + 1u), entt::entity{0});
+    ASSERT_EQ(*(rhs.data() + 2u), entt::entity{1});
+    ASSERT_EQ(*(rhs.raw() + 0u), 'a');
+    ASSERT_EQ(*(rhs.raw() + 1u), 'c');
+    ASSERT_EQ(*(rhs.raw() + 2u), 'b');
+}
+
 TEST(Storage, RespectOverlapEmptyType) {
     entt::storage<entt::entity, empty_type> lhs;
     entt::storage<entt::entity, empty_type> rhs;
@@ -787,3 +874,552 @@ TEST(Storage, ConstructorExceptionDoesNotAddToStorage) {
 
     ASSERT_TRUE(pool.empty());
 }
+
+TEST(Storage, Prefetch) {
+    entt::storage<entt::entity, int> pool;
+
+    pool.prefetch(entt::entity{0});
+    pool.construct(entt::entity{42}, 3);
+    pool.prefetch(entt::entity{42});
+    pool.prefetch(entt::entity{3});
+
+    ASSERT_EQ(pool.get(entt::entity{42}), 3);
+    ASSERT_EQ(pool.size(), 1u);
+}
+
+TEST(TickStorage, Functionalities) {
+    entt::basic_tick_storage<entt::entity, int> pool;
+    const auto &cpool = pool;
+
+    pool.construct(entt::entity{3}, 3);
+    pool.construct(entt::entity{12}, 6);
+
+    ASSERT_EQ(pool.added(entt::entity{3}), 0u);
+    ASSERT_EQ(pool.changed(entt::entity{12}), 0u);
+
+    const auto since = pool.checkpoint();
+
+    ASSERT_EQ(since, 0u);
+    ASSERT_EQ(cpool.get(entt::entity{3}), 3);
+    ASSERT_EQ(*cpool.try_get(entt::entity{12}), 6);
+    ASSERT_EQ(pool.changed(entt::entity{3}), since);
+    ASSERT_EQ(pool.changed(entt::entity{12}), since);
+
+    pool.get(entt::entity{12}) = 9;
+    pool.construct(entt::entity{42}, 42);
+
+    ASSERT_EQ(pool.changed(entt::entity{12}), 1u);
+    ASSERT_EQ(pool.added(entt::entity{12}), 0u);
+    ASSERT_EQ(pool.added(entt::entity{42}), 1u);
+
+    std::vector<entt::entity> changed{};
+    std::vector<entt::entity> added{};
+    pool.each_changed(since, [&changed](const auto entt) { changed.push_back(entt); });
+    pool.each_added(since, [&added](const auto entt) { added.push_back(entt); });
+
+    ASSERT_EQ(changed, (std::vector<entt::entity>{entt::entity{42}, entt::entity{12}}));
+    ASSERT_EQ(added, (std::vector<entt::entity>{entt::entity{42}}));
+
+    pool.destroy(entt::entity{3});
+    pool.checkpoint();
+    changed.clear();
+    pool.each_changed(since, [&changed](const auto entt) { changed.push_back(entt); });
+
+    ASSERT_EQ(changed, (std::vector<entt::entity>{entt::entity{12}, entt::entity{42}}));
+
+    changed.clear();
+    pool.each_changed(since + 1u, [&changed](const auto entt) { changed.push_back(entt); });
+
+    ASSERT_TRUE(changed.empty());
+
+    pool.touch(entt::entity{42});
+    *(pool.end() - 1) += 1;
+    pool.each_changed(since + 1u, [&changed](const auto entt) { changed.push_back(entt); });
+
+    ASSERT_EQ(changed, (std::vector<entt::entity>{entt::entity{42}}));
+    ASSERT_EQ(pool.get(entt::entity{42}), 43);
+
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(TickStorage, SortAndSwap) {
+    entt::basic_tick_storage<entt::entity, int> pool;
+    entt::entity entities[3]{entt::entity{12}, entt::entity{42}, entt::entity{7}};
+    pool.construct(std::begin(entities), std::end(entities));
+
+    const auto since = pool.checkpoint();
+    pool.get(entt::entity{42}) = 1;
+    pool.get(entt::entity{12}) = 0;
+    pool.get(entt::entity{7}) = 2;
+    pool.checkpoint();
+    pool.touch(entt::entity{42});
+
+    pool.sort(pool.begin(), pool.end(), [](const auto lhs, const auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(*(pool.data() + 0u), entt::entity{7});
+    ASSERT_EQ(*(pool.data() + 1u), entt::entity{42});
+    ASSERT_EQ(*(pool.data() + 2u), entt::entity{12});
+    ASSERT_EQ(pool.changed(entt::entity{42}), since + 2u);
+    ASSERT_EQ(pool.changed(entt::entity{12}), since + 1u);
+    ASSERT_EQ(pool.changed(entt::entity{7}), since + 1u);
+
+    pool.swap(entt::entity{42}, entt::entity{12});
+
+    ASSERT_EQ(*(pool.data() + 2u), entt::entity{42});
+    ASSERT_EQ(pool.get(entt::entity{42}), 1);
+    ASSERT_EQ(pool.changed(entt::entity{42}), since + 2u);
+    ASSERT_EQ(pool.changed(entt::entity{12}), since + 1u);
+
+    std::vector<entt::entity> changed{};
+    pool.each_changed(since + 1u, [&changed](const auto entt) { changed.push_back(entt); });
+
+    ASSERT_EQ(changed, (std::vector<entt::entity>{entt::entity{42}}));
+}
+
+TEST(TickStorage, SkipPages) {
+    entt::basic_tick_storage<entt::entity, int> pool;
+    std::vector<entt::entity> entities(1000u);
+
+    for(auto i = 0u; i < entities.size(); ++i) {
+        entities[i] = entt::entity(i);
+    }
+
+    pool.construct(entities.begin(), entities.end());
+    const auto since = pool.checkpoint();
+
+    for(auto i = 0u; i < entities.size(); i += 97u) {
+        ++pool.get(entities[i]);
+    }
+
+    std::vector<entt::entity> changed{};
+    pool.each_changed(since, [&changed](const auto entt) { changed.push_back(entt); });
+    std::sort(changed.begin(), changed.end());
+
+    ASSERT_EQ(changed.size(), 11u);
+
+    for(auto i = 0u; i < changed.size(); ++i) {
+        ASSERT_EQ(changed[i], entities[i * 97u]);
+    }
+}
+
+TEST(IndirectStorage, Functionalities) {
+    entt::basic_indirect_storage<entt::entity, int> pool;
+
+    pool.reserve(42);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.try_get(entt::entity{41}), nullptr);
+
+    pool.construct(entt::entity{41}, 3);
+    pool.construct(entt::entity{42}, 6);
+    pool.construct(entt::entity{43}, 9);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.get(entt::entity{42}), 6);
+    ASSERT_EQ(*pool.try_get(entt::entity{43}), 9);
+    ASSERT_EQ(*pool.begin(), 9);
+    ASSERT_EQ(*(pool.cend() - 1), 3);
+
+    const auto *instance = &pool.get(entt::entity{42});
+    pool.swap(entt::entity{41}, entt::entity{42});
+
+    ASSERT_EQ(*pool.data(), entt::entity{42});
+    ASSERT_EQ(&pool.get(entt::entity{42}), instance);
+    ASSERT_EQ(*(pool.end() - 1), 6);
+
+    pool.destroy(entt::entity{42});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.has(entt::entity{42}));
+    ASSERT_EQ(pool.get(entt::entity{41}), 3);
+    ASSERT_EQ(pool.get(entt::entity{43}), 9);
+    ASSERT_EQ(pool.raw()[0u] + pool.raw()[1u], 12);
+
+    pool.destroy(entt::entity{43});
+    pool.destroy(entt::entity{41});
+
+    ASSERT_TRUE(pool.empty());
+
+    entt::entity entities[2]{entt::entity{3}, entt::entity{12}};
+    auto it = pool.construct(std::begin(entities), std::end(entities), 42);
+
+    ASSERT_EQ(*it, 42);
+    ASSERT_EQ(pool.get(entt::entity{12}), 42);
+
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(IndirectStorage, SortAndRespect) {
+    entt::basic_indirect_storage<entt::entity, boxed_int> lhs;
+    entt::basic_indirect_storage<entt::entity, boxed_int> rhs;
+    std::vector<const boxed_int *> instances{};
+    lhs.reserve(8u);
+
+    for(auto i = 0u; i < 8u; ++i) {
+        instances.push_back(&lhs.construct(entt::entity(i), int((i * 5u) % 8u)));
+        rhs.construct(entt::entity(7u - i), int(i));
+    }
+
+    lhs.sort(lhs.begin(), lhs.end(), [](const auto &instance, const auto &other) {
+        return instance.value < other.value;
+    });
+
+    auto value = 0;
+
+    for(auto &&instance: lhs) {
+        ASSERT_EQ(instance.value, value++);
+    }
+
+    for(auto i = 0u; i < 8u; ++i) {
+        ASSERT_EQ(&lhs.get(entt::entity(i)), instances[i]);
+    }
+
+    rhs.respect(lhs);
+
+    for(auto i = 0u; i < 8u; ++i) {
+        ASSERT_EQ(lhs.data()[i], rhs.data()[i]);
+        ASSERT_EQ(rhs.get(rhs.data()[i]).value, 7 - int(to_integer(rhs.data()[i])));
+    }
+}
+
+TEST(StableStorage, Functionalities) {
+    entt::basic_stable_storage<entt::entity, int> pool;
+    const entt::entity entities[]{entt::entity{3}, entt::entity{4}};
+
+    pool.reserve(8u);
+    pool.construct(entt::entity{0}, 0);
+    pool.construct(entt::entity{1}, 1);
+    pool.construct(entt::entity{2}, 2);
+    pool.construct(std::begin(entities), std::end(entities), 3);
+
+    ASSERT_EQ(pool.size(), 5u);
+    ASSERT_EQ(pool.rank(entt::entity{0}), 0u);
+    ASSERT_EQ(pool.rank(entt::entity{2}), 2u);
+    ASSERT_EQ(pool.rank(entt::entity{4}), 4u);
+
+    pool.destroy(entt::entity{1});
+    pool.destroy(entt::entity{4});
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.index(entt::entity{3}), 1u);
+    ASSERT_EQ(pool.rank(entt::entity{3}), 3u);
+
+    pool.compact();
+
+    ASSERT_EQ(*(pool.data() + 0u), entt::entity{0});
+    ASSERT_EQ(*(pool.data() + 1u), entt::entity{2});
+    ASSERT_EQ(*(pool.data() + 2u), entt::entity{3});
+    ASSERT_EQ(*(pool.raw() + 0u), 0);
+    ASSERT_EQ(*(pool.raw() + 1u), 2);
+    ASSERT_EQ(*(pool.raw() + 2u), 3);
+    ASSERT_EQ(pool.rank(entt::entity{3}), 2u);
+
+    pool.construct(entt::entity{1}, 1);
+
+    ASSERT_EQ(pool.rank(entt::entity{1}), 3u);
+
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+
+    pool.construct(entt::entity{1}, 1);
+
+    ASSERT_EQ(pool.rank(entt::entity{1}), 0u);
+}
+
+TEST(StableStorage, CompactAfterSort) {
+    entt::basic_stable_storage<entt::entity, int> pool;
+
+    for(auto i = 0; i < 8; ++i) {
+        pool.construct(entt::entity(i), (i * 5) % 8);
+    }
+
+    pool.destroy(entt::entity{2});
+    pool.destroy(entt::entity{5});
+    pool.sort(pool.begin(), pool.end(), std::less<int>{});
+    pool.swap(pool.data()[0u], pool.data()[1u]);
+
+    pool.compact();
+
+    const int expected[]{0, 1, 3, 4, 6, 7};
+
+    for(auto pos = 0u; pos < pool.size(); ++pos) {
+        ASSERT_EQ(pool.data()[pos], entt::entity(expected[pos]));
+        ASSERT_EQ(pool.raw()[pos], (expected[pos] * 5) % 8);
+        ASSERT_EQ(pool.rank(pool.data()[pos]), pos);
+    }
+}
+
+TEST(SharedStorage, Functionalities) {
+    entt::basic_shared_storage<entt::entity, int> pool;
+    const entt::entity entities[]{entt::entity{3}, entt::entity{4}, entt::entity{5}};
+
+    pool.reserve(8u);
+
+    ASSERT_EQ(pool.unique(), 0u);
+    ASSERT_EQ(pool.begin(), pool.end());
+
+    const auto &instance = pool.construct(entt::entity{0}, 42);
+    pool.construct(entt::entity{1}, 42);
+    pool.construct(entt::entity{2}, 3);
+    pool.construct(std::begin(entities), std::end(entities), 42);
+
+    ASSERT_EQ(pool.size(), 6u);
+    ASSERT_EQ(pool.unique(), 2u);
+    ASSERT_EQ(&pool.get(entt::entity{1}), &instance);
+    ASSERT_EQ(&pool.get(entt::entity{5}), &instance);
+    ASSERT_EQ(*pool.try_get(entt::entity{2}), 3);
+    ASSERT_EQ(pool.try_get(entt::entity{6}), nullptr);
+    ASSERT_EQ(pool.use_count(entt::entity{0}), 5u);
+    ASSERT_EQ(pool.use_count(entt::entity{2}), 1u);
+    ASSERT_EQ(*pool.begin(), 42);
+    ASSERT_EQ(*(pool.end() - 3), 3);
+
+    ASSERT_EQ(pool.replace(entt::entity{2}, 42), 42);
+    ASSERT_EQ(pool.unique(), 1u);
+    ASSERT_EQ(pool.use_count(entt::entity{0}), 6u);
+
+    pool.replace(entt::entity{2}, 3);
+    pool.replace(entt::entity{2}, 3);
+    pool.destroy(entt::entity{0});
+    pool.destroy(entt::entity{2});
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(pool.unique(), 1u);
+    ASSERT_EQ(pool.use_count(entt::entity{1}), 4u);
+    ASSERT_EQ(pool.get(entt::entity{4}), 42);
+
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.unique(), 0u);
+}
+
+TEST(SharedStorage, ExplicitKey) {
+    entt::basic_shared_storage<entt::entity, shared_config, shared_config_hash, shared_config_equal> pool;
+
+    pool.construct(entt::entity{0}, 1, 10);
+    pool.construct(entt::entity{1}, 1, 20);
+    pool.construct(entt::entity{2}, 2, 30);
+
+    ASSERT_EQ(pool.unique(), 2u);
+    ASSERT_EQ(pool.get(entt::entity{1}).value, 10);
+
+    std::size_t count{};
+
+    pool.each_unique([&count](const auto &config, const auto uses) {
+        ASSERT_EQ(uses, config.id == 1 ? 2u : 1u);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+
+    auto other = pool;
+    other.replace(entt::entity{0}, shared_config{2, 0});
+
+    ASSERT_EQ(other.use_count(entt::entity{2}), 2u);
+    ASSERT_EQ(pool.use_count(entt::entity{2}), 1u);
+    ASSERT_EQ(&other.get(entt::entity{0}), &other.get(entt::entity{2}));
+    ASSERT_NE(&other.get(entt::entity{1}), &pool.get(entt::entity{1}));
+}
+
+TEST(SharedStorage, SortAndCluster) {
+    entt::basic_shared_storage<entt::entity, int> pool;
+
+    for(auto i = 0; i < 12; ++i) {
+        pool.construct(entt::entity(i), i % 3);
+    }
+
+    pool.cluster();
+
+    std::vector<const int *> instances{};
+
+    for(auto &&instance: pool) {
+        if(instances.empty() || instances.back() != &instance) {
+            instances.push_back(&instance);
+        }
+    }
+
+    ASSERT_EQ(instances.size(), 3u);
+
+    pool.sort(pool.begin(), pool.end(), std::greater<int>{});
+
+    ASSERT_EQ(*pool.begin(), 2);
+    ASSERT_EQ(*(pool.end() - 1), 0);
+
+    for(auto pos = 0u; pos < pool.size(); ++pos) {
+        ASSERT_EQ(pool.get(pool.data()[pos]), int(to_integer(pool.data()[pos])) % 3);
+    }
+}
+
+TEST(BufferedStorage, Functionalities) {
+    entt::basic_buffered_storage<entt::entity, int> pool;
+    const entt::entity entities[]{entt::entity{3}, entt::entity{4}};
+
+    pool.reserve(8u);
+    pool.construct(entt::entity{0}, 0);
+    pool.construct(entt::entity{1}, 1);
+    pool.construct(std::begin(entities), std::end(entities), 3);
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(pool.get(entt::entity{1}), 1);
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{1}), 1);
+    ASSERT_EQ(*std::as_const(pool).try_get(entt::entity{4}), 3);
+    ASSERT_EQ(pool.try_get(entt::entity{2}), nullptr);
+
+    for(auto &&instance: pool) {
+        instance += 10;
+    }
+
+    ASSERT_EQ(pool.get(entt::entity{0}), 10);
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{0}), 0);
+    ASSERT_EQ(*std::as_const(pool).begin(), 3);
+
+    pool.swap_buffers();
+
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{0}), 10);
+    ASSERT_EQ(*std::as_const(pool).raw(), 10);
+    ASSERT_EQ(pool.get(entt::entity{0}), 0);
+
+    pool.get(entt::entity{0}) = 20;
+    pool.destroy(entt::entity{1});
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.get(entt::entity{4}), 3);
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{0}), 10);
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{4}), 13);
+
+    pool.swap_buffers();
+    pool.destroy(entt::entity{3});
+
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{0}), 20);
+    ASSERT_EQ(pool.get(entt::entity{0}), 10);
+    ASSERT_EQ(pool.get(entt::entity{4}), 13);
+
+    pool.swap_buffers(true);
+
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{0}), 10);
+    ASSERT_EQ(pool.get(entt::entity{0}), 10);
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{4}), 13);
+    ASSERT_EQ(pool.get(entt::entity{4}), 13);
+
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.begin(), pool.end());
+}
+
+TEST(BufferedStorage, SortAndSwap) {
+    entt::basic_buffered_storage<entt::entity, int, 3u> pool;
+
+    for(auto i = 0; i < 4; ++i) {
+        pool.construct(entt::entity(i), i);
+    }
+
+    for(auto i = 0; i < 4; ++i) {
+        pool.get(entt::entity(i)) = 10 * i;
+    }
+
+    pool.swap_buffers();
+
+    for(auto i = 0; i < 4; ++i) {
+        pool.get(entt::entity(i)) = 100 * i;
+    }
+
+    pool.sort(pool.begin(), pool.end(), std::greater<int>{});
+    pool.swap(entt::entity{0}, entt::entity{1});
+
+    for(auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(pool.get(entt::entity(i)), 100 * i);
+        ASSERT_EQ(std::as_const(pool).get(entt::entity(i)), 10 * i);
+    }
+
+    ASSERT_EQ(*pool.begin(), 300);
+
+    pool.swap_buffers();
+
+    for(auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(std::as_const(pool).get(entt::entity(i)), 100 * i);
+        ASSERT_EQ(pool.get(entt::entity(i)), i);
+    }
+
+    pool.swap_buffers(true);
+
+    for(auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(std::as_const(pool).get(entt::entity(i)), i);
+        ASSERT_EQ(pool.get(entt::entity(i)), i);
+    }
+
+    pool.get(entt::entity{2}) = 42;
+
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{2}), 2);
+    ASSERT_EQ(pool.get(entt::entity{2}), 42);
+}
+
+TEST(BufferedStorage, SwapAndRefresh) {
+    entt::basic_buffered_storage<entt::entity, int, 3u> pool;
+
+    for(auto i = 0; i < 4; ++i) {
+        pool.construct(entt::entity(i), i);
+        pool.get(entt::entity(i)) = 100 * i;
+    }
+
+    pool.swap_buffers(true);
+
+    for(auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(std::as_const(pool).get(entt::entity(i)), 100 * i);
+        ASSERT_EQ(pool.get(entt::entity(i)), 100 * i);
+    }
+
+    pool.get(entt::entity{2}) = 42;
+
+    ASSERT_EQ(std::as_const(pool).get(entt::entity{2}), 200);
+}
+
+TEST(BitsetIndexedStorage, Functionalities) {
+    entt::basic_bitset_indexed_storage<entt::entity, empty_type> pool;
+    const entt::entity entities[]{entt::entity{64}, entt::entity{130}};
+
+    ASSERT_EQ(pool.words(), 0u);
+    ASSERT_FALSE(pool.test(entt::entity{0}));
+    ASSERT_EQ(pool.word(3u), 0u);
+
+    pool.construct(entt::entity{1});
+    pool.construct(std::begin(entities), std::end(entities));
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.words(), 3u);
+    ASSERT_TRUE(pool.has(entt::entity{64}));
+    ASSERT_TRUE(pool.test(entt::entity{1}));
+    ASSERT_TRUE(pool.test(entt::entity{64}));
+    ASSERT_TRUE(pool.test(entt::entity{130}));
+    ASSERT_FALSE(pool.test(entt::entity{2}));
+    ASSERT_FALSE(pool.test(entt::entity{1000}));
+    ASSERT_EQ(pool.word(0u), 2u);
+    ASSERT_EQ(pool.word(1u), 1u);
+    ASSERT_EQ(pool.word(2u), 4u);
+
+    pool.destroy(entt::entity{64});
+
+    ASSERT_FALSE(pool.has(entt::entity{64}));
+    ASSERT_FALSE(pool.test(entt::entity{64}));
+    ASSERT_EQ(pool.word(1u), 0u);
+
+    const entt::entity others[]{entt::entity{1}, entt::entity{130}};
+    pool.destroy(std::begin(others), std::end(others));
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.word(0u), 0u);
+    ASSERT_EQ(pool.word(2u), 0u);
+
+    pool.construct(entt::entity{3});
+    pool.reset();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.test(entt::entity{3}));
+    ASSERT_EQ(pool.words(), 0u);
+}
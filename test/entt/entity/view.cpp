@@ -1,10 +1,32 @@
+#include <chrono>
+#include <vector>
+#include <algorithm>
 #include <utility>
+#include <functional>
 #include <type_traits>
 #include <gtest/gtest.h>
 #include <entt/entity/helper.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
 
+struct tracked { int value; };
+
+template<>
+struct entt::storage<entt::entity, tracked>: entt::basic_tick_storage<entt::entity, tracked> {};
+
+struct visible {};
+struct selected {};
+struct hidden {};
+
+template<>
+struct entt::storage<entt::entity, visible>: entt::basic_bitset_indexed_storage<entt::entity, visible> {};
+
+template<>
+struct entt::storage<entt::entity, selected>: entt::basic_bitset_indexed_storage<entt::entity, selected> {};
+
+template<>
+struct entt::storage<entt::entity, hidden>: entt::basic_bitset_indexed_storage<entt::entity, hidden> {};
+
 TEST(SingleComponentView, Functionalities) {
     entt::registry registry;
     auto view = registry.view<char>();
@@ -549,3 +571,349 @@ TEST(MultiComponentView, Less) {
         ASSERT_EQ(entity, entt);
     });
 }
+
+TEST(MultiComponentView, Plan) {
+    entt::registry registry;
+    const auto view = registry.view<int, char, double>(entt::exclude<float>);
+
+    for(auto i = 0; i < 8; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        registry.assign<double>(entity);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+
+        if(i < 6) {
+            registry.assign<float>(entity);
+        }
+    }
+
+    using plan_type = typename decltype(view)::plan_type;
+
+    ASSERT_EQ(view.plan(), (plan_type{1u, 3u, 0u, 2u}));
+
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> planned;
+
+    view.each([&expected](const auto entity, int, char, double) { expected.push_back(entity); });
+    view.each(view.plan(), [&planned](const auto entity, int, char, double) { planned.push_back(entity); });
+
+    ASSERT_EQ(expected, planned);
+    ASSERT_EQ(planned.size(), 1u);
+
+    planned.clear();
+    view.each(plan_type{2u, 0u, 1u, 3u}, [&planned](const auto entity, int, char, double) { planned.push_back(entity); });
+
+    ASSERT_EQ(planned.size(), 1u);
+    ASSERT_EQ(planned[0], expected[0]);
+
+    view.each(view.plan(), [](int &value, char, double) { value = 42; });
+
+    ASSERT_EQ(view.get<int>(expected[0]), 42);
+}
+
+TEST(MultiComponentView, EachWithLookahead) {
+    entt::registry registry;
+    const auto view = registry.view<int, char>(entt::exclude<double>);
+
+    for(auto i = 0; i < 64; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity);
+        }
+
+        if(i % 3) {
+            registry.assign<double>(entity);
+        }
+    }
+
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> prefetched;
+
+    view.each([&expected](const auto entity, int, char) { expected.push_back(entity); });
+    view.each(entt::lookahead<4>, [&prefetched](const auto entity, int, char) { prefetched.push_back(entity); });
+
+    ASSERT_EQ(expected, prefetched);
+
+    prefetched.clear();
+    view.each<int>(entt::lookahead<1>, [&prefetched](const auto entity, int, char) { prefetched.push_back(entity); });
+
+    ASSERT_EQ(prefetched.size(), expected.size());
+
+    view.each(entt::lookahead<128>, [](int &value, char) { value = -1; });
+
+    for(const auto entity: expected) {
+        ASSERT_EQ(view.get<int>(entity), -1);
+    }
+
+    registry.view<int, char>().each(entt::lookahead<2>, [count = 0u](int, char) mutable {
+        ASSERT_LT(count++, 32u);
+    });
+}
+
+TEST(SingleComponentView, EachWithCursor) {
+    entt::registry registry;
+    const auto view = registry.view<int>();
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> visited;
+
+    for(auto i = 0; i < 10; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    view.each([&expected](const auto entity, int) { expected.push_back(entity); });
+
+    entt::cursor cursor{};
+
+    ASSERT_FALSE(cursor.done());
+
+    while(!cursor.done()) {
+        cursor = view.each(cursor, 3u, [&visited](const auto entity, int) { visited.push_back(entity); });
+    }
+
+    ASSERT_EQ(expected, visited);
+    ASSERT_EQ(cursor.remaining(), 0u);
+
+    visited.clear();
+    cursor = view.each(entt::cursor{}, 4u, [&visited](const auto entity, int &) { visited.push_back(entity); });
+
+    ASSERT_EQ(cursor.remaining(), 6u);
+
+    for(auto entity: expected) {
+        if(std::find(visited.cbegin(), visited.cend(), entity) == visited.cend() && to_integer(entity) % 2) {
+            registry.destroy(entity);
+        }
+    }
+
+    cursor = view.each(cursor, 10u, [&visited](int &value) { value = -1; });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(view.size(), 7u);
+
+    for(auto entity: view) {
+        ASSERT_TRUE(std::find(visited.cbegin(), visited.cend(), entity) != visited.cend() || view.get(entity) == -1);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::hours{1};
+    std::size_t counter{};
+    cursor = view.each(entt::cursor{}, deadline, [&counter](int) { ++counter; });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(counter, view.size());
+
+    cursor = view.each(entt::cursor{}, std::chrono::steady_clock::now() - std::chrono::hours{1}, [](int) { FAIL(); });
+
+    ASSERT_FALSE(cursor.done());
+}
+
+TEST(MultiComponentView, EachWithCursor) {
+    entt::registry registry;
+    const auto view = registry.view<int, char>(entt::exclude<double>);
+    std::vector<entt::entity> expected;
+    std::vector<entt::entity> visited;
+
+    for(auto i = 0; i < 20; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+        registry.assign<char>(entity);
+
+        if(i % 3 == 0) {
+            registry.assign<double>(entity);
+        }
+    }
+
+    view.each([&expected](const auto entity, int, char) { expected.push_back(entity); });
+
+    auto cursor = view.each(entt::cursor{}, 5u, [&visited](const auto entity, int, char) { visited.push_back(entity); });
+
+    ASSERT_FALSE(cursor.done());
+    ASSERT_EQ(cursor.remaining(), 15u);
+
+    // the leading pool is tied to the cursor, it doesn't change when resumed
+    registry.remove<char>(expected.back());
+    cursor = view.each(cursor, 100u, [&visited](const auto entity, int, char) { visited.push_back(entity); });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(visited.size(), expected.size() - 1u);
+    ASSERT_TRUE(std::equal(visited.cbegin(), visited.cend(), expected.cbegin()));
+
+    std::size_t counter{};
+    cursor = view.each(entt::cursor{}, std::chrono::steady_clock::now() + std::chrono::hours{1}, [&counter](int, char) { ++counter; });
+
+    ASSERT_TRUE(cursor.done());
+    ASSERT_EQ(counter, visited.size());
+}
+
+TEST(SingleComponentView, TransformReduce) {
+    entt::registry registry;
+    auto view = registry.view<int>();
+
+    ASSERT_EQ(view.reduce(0, std::plus<>{}), 0);
+
+    for(auto i = 0; i < 100; ++i) {
+        registry.assign<int>(registry.create(), i);
+    }
+
+    const auto sequential = view.transform_reduce(0, std::plus<>{}, [](const int value) { return 2 * value; }, 8u, entt::parallel_for{1u});
+    const auto parallel = view.transform_reduce(0, std::plus<>{}, [](const int value) { return 2 * value; }, 8u, entt::parallel_for{4u});
+
+    ASSERT_EQ(sequential, 9900);
+    ASSERT_EQ(parallel, sequential);
+    ASSERT_EQ(view.reduce(1, std::plus<>{}, 7u), 4951);
+
+    ASSERT_EQ(view.transform_reduce(std::size_t{}, std::plus<>{}, [&registry](const auto entity, const int &value) {
+        return std::size_t(registry.get<int>(entity) == value);
+    }), view.size());
+}
+
+TEST(MultiComponentView, TransformReduce) {
+    entt::registry registry;
+    auto view = registry.view<int, const char>(entt::exclude<double>);
+
+    ASSERT_EQ(view.transform_reduce(0, std::plus<>{}, [](const int value, const char) { return value; }), 0);
+
+    for(auto i = 0; i < 100; ++i) {
+        const auto entity = registry.create();
+        registry.assign<int>(entity, i);
+
+        if(i % 2) {
+            registry.assign<char>(entity, 'c');
+        }
+
+        if(i % 3 == 0) {
+            registry.assign<double>(entity);
+        }
+    }
+
+    auto expected = 0;
+
+    view.each([&expected](const int value, const char) {
+        expected += value;
+    });
+
+    const auto sequential = view.transform_reduce(0, std::plus<>{}, [](const int value, const char) { return value; }, 4u, entt::parallel_for{1u});
+    const auto parallel = view.transform_reduce(0, std::plus<>{}, [](const auto, const int value, const char) { return value; }, 4u, entt::parallel_for{4u});
+
+    ASSERT_EQ(sequential, expected);
+    ASSERT_EQ(parallel, expected);
+}
+
+TEST(SingleComponentView, EachChanged) {
+    entt::registry registry;
+    auto view = registry.view<tracked>();
+    auto cview = std::as_const(registry).view<const tracked>();
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<tracked>(e0, 0);
+    registry.assign<tracked>(e1, 1);
+
+    const auto since = registry.pool<tracked>().checkpoint();
+
+    registry.assign<tracked>(e2, 2);
+    registry.replace<tracked>(e0, 3);
+    cview.each([](const auto &) {});
+
+    std::vector<entt::entity> entities{};
+    view.each(entt::changed<tracked>(since), [&entities](const auto entity, auto &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e2, e0}));
+
+    entities.clear();
+    cview.each(entt::added<tracked>(since), [&entities](const auto entity, const tracked &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e2}));
+
+    const auto next = registry.pool<tracked>().checkpoint();
+    view.each([](tracked &instance) { ++instance.value; });
+    entities.clear();
+    cview.each(entt::changed<tracked>(next), [&entities](const auto entity, const tracked &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities.size(), 3u);
+}
+
+TEST(MultiComponentView, EachChanged) {
+    entt::registry registry;
+    auto view = registry.view<tracked, const char>(entt::exclude<double>);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    const auto e2 = registry.create();
+
+    registry.assign<tracked>(e0, 0);
+    registry.assign<tracked>(e1, 1);
+    registry.assign<tracked>(e2, 2);
+    registry.assign<char>(e0);
+    registry.assign<char>(e1);
+    registry.assign<double>(e1);
+
+    const auto since = registry.pool<tracked>().checkpoint();
+
+    registry.get<tracked>(e0).value = 3;
+    registry.get<tracked>(e1).value = 4;
+    registry.get<tracked>(e2).value = 5;
+
+    std::vector<entt::entity> entities{};
+    view.each(entt::changed<tracked>(since), [&entities](const auto entity, tracked &, const char &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e0}));
+
+    auto count = 0u;
+    view.each(entt::added<tracked>(since), [&count](auto &&...) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+
+    registry.remove<double>(e1);
+    view.each(entt::changed<tracked>(since), [&count](tracked &, const char &) { ++count; });
+
+    ASSERT_EQ(count, 2u);
+}
+
+TEST(MultiComponentView, EachBitset) {
+    entt::registry registry;
+    auto view = registry.view<visible, const selected>(entt::exclude<hidden>);
+
+    const auto e0 = registry.create();
+    const auto e1 = registry.create();
+    registry.destroy(e1);
+    const auto e2 = registry.create();
+
+    for(auto i = 0; i < 100; ++i) {
+        registry.create();
+    }
+
+    const auto e3 = registry.create();
+
+    registry.assign<visible>(e3);
+    registry.assign<visible>(e0);
+    registry.assign<visible>(e2);
+    registry.assign<selected>(e0);
+    registry.assign<selected>(e2);
+    registry.assign<selected>(e3);
+    registry.assign<hidden>(e0);
+
+    ASSERT_TRUE(registry.pool<visible>().test(e2));
+    ASSERT_FALSE(registry.pool<visible>().test(entt::entity{1000}));
+
+    std::vector<entt::entity> entities{};
+    view.each([&entities](const auto entity, visible, const selected &) { entities.push_back(entity); });
+
+    ASSERT_EQ(entities, (std::vector<entt::entity>{e2, e3}));
+
+    auto count = 0u;
+    registry.remove<hidden>(e0);
+    view.each([&count](auto...) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+
+    registry.reset<selected>();
+    view.each([&count](auto...) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+}
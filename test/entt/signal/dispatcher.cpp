@@ -1,11 +1,14 @@
 #include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/core/type_traits.hpp>
 #include <entt/signal/dispatcher.hpp>
 
 struct an_event {};
 struct another_event {};
 struct one_more_event {};
+struct numbered_event { int value; };
 
 ENTT_NAMED_TYPE(an_event);
 
@@ -15,8 +18,24 @@ struct receiver {
     }
 
     void receive(const an_event &) { ++cnt; }
+    static void cascade(entt::dispatcher &dispatcher, const numbered_event &event) {
+        dispatcher.enqueue(numbered_event{event.value + 1});
+    }
+
+    void record(const numbered_event &event) { values.push_back(event.value); }
+
+    void record_batch(const numbered_event *event, std::size_t size) {
+        batches.push_back(size);
+
+        for(; size; --size, ++event) {
+            values.push_back(event->value);
+        }
+    }
+
     void reset() { cnt = 0; }
     int cnt{0};
+    std::vector<int> values{};
+    std::vector<std::size_t> batches{};
 };
 
 TEST(Dispatcher, Functionalities) {
@@ -83,3 +102,113 @@ TEST(Dispatcher, StopAndGo) {
 
     ASSERT_EQ(receiver.cnt, 2);
 }
+
+TEST(Dispatcher, Lanes) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<numbered_event>().connect<&receiver::record>(receiver);
+    const auto lanes = dispatcher.lanes<numbered_event>(8u);
+    dispatcher.enqueue(numbered_event{-1});
+
+    entt::parallel_for{4u}(8u, [&lanes, &dispatcher](const std::size_t job) {
+        if(job == 0u) {
+            // other types of events can be used meanwhile
+            dispatcher.enqueue<one_more_event>();
+        }
+
+        for(auto i = 0; i < 100; ++i) {
+            lanes.enqueue(job, numbered_event{static_cast<int>(job) * 100 + i});
+        }
+    });
+
+    ASSERT_TRUE(receiver.values.empty());
+
+    dispatcher.update<numbered_event>();
+
+    ASSERT_EQ(receiver.values.size(), 801u);
+    ASSERT_EQ(receiver.values[0u], -1);
+
+    for(auto pos = 1u; pos < receiver.values.size(); ++pos) {
+        ASSERT_EQ(receiver.values[pos], static_cast<int>(pos) - 1);
+    }
+
+    receiver.values.clear();
+    lanes.enqueue(3u, numbered_event{42});
+    dispatcher.discard<numbered_event>();
+    dispatcher.update();
+
+    ASSERT_TRUE(receiver.values.empty());
+
+    lanes.enqueue(3u, numbered_event{42});
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.values.size(), 1u);
+    ASSERT_EQ(receiver.values[0u], 42);
+}
+
+TEST(Dispatcher, Cascade) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.sink<numbered_event>().connect<&receiver::record>(receiver);
+    dispatcher.sink<numbered_event>().connect<&receiver::cascade>(dispatcher);
+    dispatcher.enqueue(numbered_event{0});
+    dispatcher.enqueue(numbered_event{10});
+
+    for(auto i = 0; i < 3; ++i) {
+        receiver.values.clear();
+        dispatcher.update<numbered_event>();
+
+        ASSERT_EQ(receiver.values.size(), 2u);
+        ASSERT_EQ(receiver.values[0u], i);
+        ASSERT_EQ(receiver.values[1u], 10 + i);
+    }
+
+    receiver.values.clear();
+    dispatcher.sink<numbered_event>().disconnect<&receiver::cascade>(dispatcher);
+    dispatcher.update();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.values.size(), 2u);
+    ASSERT_EQ(receiver.values[0u], 3);
+    ASSERT_EQ(receiver.values[1u], 13);
+}
+
+TEST(Dispatcher, BatchSink) {
+    entt::dispatcher dispatcher;
+    receiver receiver;
+
+    dispatcher.batch_sink<numbered_event>().connect<&receiver::record_batch>(receiver);
+    dispatcher.update<numbered_event>();
+
+    ASSERT_TRUE(receiver.batches.empty());
+
+    dispatcher.enqueue(numbered_event{0});
+    dispatcher.enqueue(numbered_event{1});
+    dispatcher.enqueue(numbered_event{2});
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.batches.size(), 1u);
+    ASSERT_EQ(receiver.batches[0u], 3u);
+    ASSERT_EQ(receiver.values, (std::vector<int>{0, 1, 2}));
+
+    receiver.values.clear();
+    receiver.batches.clear();
+    dispatcher.sink<numbered_event>().connect<&receiver::record>(receiver);
+    dispatcher.trigger(numbered_event{3});
+    const auto lanes = dispatcher.lanes<numbered_event>(2u);
+    lanes.enqueue(1u, numbered_event{4});
+    lanes.enqueue(1u, numbered_event{5});
+    dispatcher.update<numbered_event>();
+
+    ASSERT_EQ(receiver.batches, (std::vector<std::size_t>{1u, 2u}));
+    ASSERT_EQ(receiver.values, (std::vector<int>{3, 3, 4, 5, 4, 5}));
+
+    receiver.values.clear();
+    dispatcher.batch_sink<numbered_event>().disconnect<&receiver::record_batch>(receiver);
+    dispatcher.enqueue(numbered_event{6});
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.values, (std::vector<int>{6}));
+}
@@ -416,3 +416,113 @@ TEST_F(SigH, BeforeListenerNotPresent) {
 
     ASSERT_EQ(functor.value, 2);
 }
+
+TEST(SlotSigH, Functionalities) {
+    entt::slot_sigh<void(int &)> sigh;
+    sigh_listener listener;
+    int v = 0;
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_FALSE(sigh.contains({}));
+
+    const auto first = sigh.connect<&sigh_listener::f>();
+    const auto second = sigh.connect<&sigh_listener::f>();
+
+    ASSERT_EQ(sigh.size(), 2u);
+    ASSERT_TRUE(sigh.contains(first));
+    ASSERT_TRUE(sigh.contains(second));
+
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 42);
+
+    sigh.disconnect(first);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_FALSE(sigh.contains(first));
+    ASSERT_TRUE(sigh.contains(second));
+
+    sigh.disconnect(first);
+
+    ASSERT_EQ(sigh.size(), 1u);
+
+    const auto third = sigh.connect<&sigh_listener::l>(listener);
+
+    ASSERT_EQ(third.index, first.index);
+    ASSERT_NE(third.version, first.version);
+    ASSERT_FALSE(sigh.contains(first));
+    ASSERT_TRUE(sigh.contains(third));
+
+    sigh.disconnect(first);
+
+    ASSERT_EQ(sigh.size(), 2u);
+    ASSERT_TRUE(sigh.contains(third));
+
+    sigh.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_FALSE(sigh.contains(second));
+    ASSERT_FALSE(sigh.contains(third));
+
+    v = 0;
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 0);
+}
+
+TEST(SlotSigH, DisconnectInTheMiddle) {
+    entt::slot_sigh<void(int)> sigh;
+    std::vector<decltype(sigh)::handle_type> handles;
+    before_after::value = 0;
+
+    for(auto i = 0; i < 4; ++i) {
+        handles.push_back(sigh.connect<&before_after::static_add>());
+    }
+
+    sigh.disconnect(handles[1]);
+    sigh.disconnect(handles[0]);
+    sigh.publish(1);
+
+    ASSERT_EQ(before_after::value, 2);
+    ASSERT_TRUE(sigh.contains(handles[2]));
+    ASSERT_TRUE(sigh.contains(handles[3]));
+
+    sigh.disconnect(handles[3]);
+    sigh.publish(1);
+
+    ASSERT_EQ(before_after::value, 3);
+
+    const auto other = sigh.connect<&before_after::static_add>();
+    const auto another = sigh.connect<&before_after::static_add>();
+    const auto last = sigh.connect<&before_after::static_add>();
+
+    ASSERT_EQ(other.index, handles[3].index);
+    ASSERT_EQ(another.index, handles[0].index);
+    ASSERT_EQ(last.index, handles[1].index);
+    ASSERT_EQ(sigh.size(), 4u);
+
+    sigh.publish(1);
+
+    ASSERT_EQ(before_after::value, 7);
+}
+
+TEST(SlotSigH, Collector) {
+    entt::slot_sigh<bool(int)> sigh;
+    sigh_listener listener;
+    int cnt = 0;
+
+    sigh.connect<&sigh_listener::g>(&listener);
+    sigh.connect<&sigh_listener::h>(listener);
+
+    sigh.collect([&cnt](bool value) {
+        ASSERT_TRUE(value);
+        ++cnt;
+    }, 42);
+
+    ASSERT_EQ(cnt, 2);
+
+    cnt = 0;
+    sigh.collect([&cnt](bool) { ++cnt; return true; }, 42);
+
+    ASSERT_EQ(cnt, 1);
+}